@@ -805,6 +805,14 @@ void ComputeLinearScanOrder::compute_dominator_impl(BlockBegin* cur, BlockBegin*
 }
 
 
+// The weight only breaks ties between blocks whose predecessors are all
+// emitted, so layout stays topological; loop depth occupies the top bits
+// and the flag bits below sink throw, return and exception-entry blocks
+// towards the end.  These are static approximations of hotness.  Feeding
+// real interpreter branch counts from the MethodData in here would need
+// per-block frequencies propagated by the graph builder, and any such
+// bits must stay below the loop-depth field: the verifier and linear
+// scan both rely on the blocks of a loop remaining contiguous.
 int ComputeLinearScanOrder::compute_weight(BlockBegin* cur) {
   BlockBegin* single_sux = NULL;
   if (cur->number_of_sux() == 1) {
@@ -1256,6 +1256,34 @@ void LinearScan::add_register_hints(LIR_Op* op) {
       }
       break;
     }
+    case lir_add:       // fall through
+    case lir_sub:       // fall through
+    case lir_mul:       // fall through
+    case lir_logic_and: // fall through
+    case lir_logic_or:  // fall through
+    case lir_logic_xor: // fall through
+    case lir_shl:       // fall through
+    case lir_shr:       // fall through
+    case lir_ushr: {
+      // Two-address targets require the result in the same register as the
+      // left input and insert a move when it is not.  The hint is only a
+      // preference, so this is also harmless on three-address targets.
+      assert(op->as_Op2() != NULL, "arithmetic op must be LIR_Op2");
+      LIR_Op2* op2 = (LIR_Op2*)op;
+
+      LIR_Opr left = op2->in_opr1();
+      LIR_Opr result = op2->result_opr();
+
+      if (result->is_register() && left->is_register()) {
+        Interval* from = interval_at(reg_num(left));
+        Interval* to = interval_at(reg_num(result));
+        if (from != NULL && to != NULL) {
+          to->set_register_hint(from);
+          TRACE_LINEAR_SCAN(4, tty->print_cr("operation at op_id %d: added hint from interval %d to %d", op2->id(), from->reg_num(), to->reg_num()));
+        }
+      }
+      break;
+    }
     default:
       break;
   }
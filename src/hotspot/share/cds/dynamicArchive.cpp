@@ -398,6 +398,15 @@ void DynamicArchive::dump_for_jcmd(const char* archive_name, TRAPS) {
   dump(archive_name, THREAD);
 }
 
+// A running service does not have to wait for a clean exit to capture
+// newly loaded classes: with -XX:+RecordDynamicDumpInfo the jcmd
+// "VM.cds dynamic_dump" path above produces a fresh dynamic archive from
+// the live process at any point.  Each dump is still a complete rewrite
+// executed in a safepoint operation, because the archive regions are one
+// relocated, checksummed unit laid out against the base archive — there
+// is no append format to which a delta of post-archive classes could be
+// attached incrementally.  Converging a long-lived process therefore
+// means re-issuing the jcmd dump, not streaming into the existing file.
 void DynamicArchive::dump(const char* archive_name, TRAPS) {
   // copy shared path table to saved.
   FileMapInfo::clone_shared_path_table(CHECK);
@@ -744,6 +744,16 @@ void HeapShared::resolve_classes_for_subgraph_of(Klass* k, JavaThread* THREAD) {
   }
 }
 
+// Subgraph materialization is already demand-driven at this level: this
+// is called from the <clinit> barrier of the subgraph's root class, so a
+// service that never touches e.g. the charset tables never runs the
+// corresponding subgraph initialization.  The remaining eager cost is at
+// the region level — when the archived heap regions cannot be mapped
+// into the Java heap they are copied in full at startup, and even when
+// mapped, GC relocation of the regions materializes everything.  Making
+// region residency itself lazy is a GC-side property (keeping mapped
+// pages untouched until faulted), not something this per-subgraph hook
+// can defer further.
 void HeapShared::initialize_from_archived_subgraph(Klass* k, JavaThread* THREAD) {
   if (!is_fully_available()) {
     return; // nothing to do
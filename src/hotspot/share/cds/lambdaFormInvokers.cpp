@@ -51,6 +51,15 @@
 GrowableArrayCHeap<char*, mtClassShared>* LambdaFormInvokers::_lambdaform_lines = nullptr;
 Array<Array<char>*>*  LambdaFormInvokers::_static_archive_invokers = nullptr;
 
+// Lines describing LambdaForm invokers observed in the training run are
+// collected here, replayed at dump time through CDS.generateLambdaFormHolderClasses
+// and the regenerated holder classes archived pre-linked, so a production run
+// loads them instead of re-spinning the bytecodes.  Only forms that the Java
+// runtime compiles into the four holder classes below are eligible: other
+// LambdaForms live as ordinary heap objects referenced from MethodHandle
+// instances, and archiving those would require archiving the method handle
+// object graph itself.  The JIT-compiled code of the invokers is likewise not
+// archived; only the class bytes and their linked metadata are.
 #define NUM_FILTER 4
 static const char* filter[NUM_FILTER] = {"java.lang.invoke.Invokers$Holder",
                                          "java.lang.invoke.DirectMethodHandle$Holder",
@@ -916,6 +916,17 @@ bool MetaspaceShared::is_shared_dynamic(void* p) {
   }
 }
 
+// Exactly two layers are supported: the static archive and one dynamic
+// archive dumped against it.  Cross-archive pointers work because the
+// dynamic dump knows the static archive's requested base and encodes
+// references to it directly; everything on both sides is laid out
+// against one contiguous [base, top) range (see the single
+// shared_metaspace_range below, is_shared_dynamic, and the archived
+// heap's single narrow-oop window).  Stacking N per-service archives on
+// a common platform layer would need per-layer relocation of metadata
+// and heap references and per-layer membership tests everywhere this
+// file assumes "static below, dynamic above" — a format revision, not
+// an extension of this function.
 void MetaspaceShared::initialize_runtime_shared_and_meta_spaces() {
   assert(UseSharedSpaces, "Must be called when UseSharedSpaces is enabled");
   MapArchiveResult result = MAP_ARCHIVE_OTHER_FAILURE;
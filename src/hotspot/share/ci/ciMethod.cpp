@@ -319,6 +319,15 @@ bool ciMethod::has_balanced_monitors() {
 
 // ------------------------------------------------------------------
 // ciMethod::get_flow_analysis
+//
+// The result is memoized for this compilation only.  Reusing it across
+// compilations of the same method (e.g. for a later OSR variant) is not
+// as simple as hoisting the cache: the ciTypeFlow and every ciType it
+// references live in the ciEnv arena that dies with the compile task,
+// and the analysis bakes in CI state (class initialization, profile
+// queries) that the dependency machinery does not currently track.  A
+// broker-level cache needs arena-independent flow results plus an
+// invalidation epoch before it can be correct.
 ciTypeFlow* ciMethod::get_flow_analysis() {
 #if defined(COMPILER2)
   if (_flow == NULL) {
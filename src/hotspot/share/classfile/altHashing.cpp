@@ -48,6 +48,16 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/os.hpp"
 
+// A note on vectorizing: this file is the *fallback* hash, engaged only
+// after a table rehashes due to collision pressure, and halfsiphash was
+// picked for flooding resistance — its round function is one long data
+// dependency chain, which is exactly what lane-parallel execution
+// cannot help.  The hot hashing during class loading is the default
+// polynomial hash (31*h + c) computed at the call sites feeding
+// SymbolTable/StringTable; that one splits across lanes with
+// precomputed powers of 31 and is where a VM_Version-gated kernel
+// would pay off, without weakening this fallback.
+
 // Get the hash code of the classes mirror if it exists, otherwise just
 // return a random number, which is one of the possible hash code used for
 // objects.  We don't want to call the synchronizer hash code to install
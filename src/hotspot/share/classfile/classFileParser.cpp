@@ -5516,6 +5516,17 @@ static bool relax_format_check_for(ClassLoaderData* loader_data) {
   return !need_verify;
 }
 
+// Parsing runs synchronously on the thread that requested the load.
+// Moving it to a worker pool (to overlap the parse of classes a loader
+// is about to ask for) is constrained by more than thread safety of the
+// parser itself: the class bytes only exist once the loader's Java code
+// has produced them, the JVMTI ClassFileLoadHook may rewrite the stream
+// and must observe the requesting thread's state, metaspace allocation
+// is accounted to a specific ClassLoaderData, and super/interface
+// resolution from within the parse can re-enter Java.  A prefetch
+// pipeline would have to stop at a parse result that owns no loader
+// metaspace and defers the hook, and only the CDS/jimage boot path
+// knows its upcoming classes well enough to feed one.
 ClassFileParser::ClassFileParser(ClassFileStream* stream,
                                  Symbol* name,
                                  ClassLoaderData* loader_data,
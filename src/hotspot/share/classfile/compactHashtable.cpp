@@ -156,7 +156,17 @@ void CompactHashtableWriter::dump_table(NumberSeq* summary) {
 }
 
 
-// Write the compact table
+// Write the compact table.
+//
+// Construction is single-threaded but linear: add() appends into the
+// target bucket directly, and the two passes above size and fill the
+// archived arrays in one sweep each, so table build time is dominated by
+// the callers producing the entries, not by this writer.  Parallelizing
+// the fill would also require making ArchiveBuilder's region allocation
+// safe for concurrent new_ro_array calls, which it is not.  Ordering
+// entries within a bucket by expected probe frequency buys little here:
+// buckets are sized to hold about SharedSymbolTableBucketSize entries
+// and most collapse to the value-only form with no scan at all.
 void CompactHashtableWriter::dump(SimpleCompactHashtable *cht, const char* table_name) {
   NumberSeq summary;
   allocate_table();
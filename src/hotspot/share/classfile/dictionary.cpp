@@ -134,6 +134,12 @@ bool Dictionary::resize_if_needed() {
   return (desired_size != 0);
 }
 
+// The check short-circuits globally once it is known that no security
+// manager can ever be installed (allow_security_manager is sticky), and
+// the pd_set walk below is an acquire-ordered read of an immutable-link
+// chain, so validation never takes a lock.  The SystemDictionary_lock in
+// add_protection_domain covers insertion only and is reached just when a
+// security manager is allowed and the domain was not yet recorded.
 bool DictionaryEntry::is_valid_protection_domain(Handle protection_domain) {
 
   return protection_domain() == NULL || !java_lang_System::allow_security_manager()
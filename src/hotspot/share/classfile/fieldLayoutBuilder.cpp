@@ -546,6 +546,18 @@ void FieldLayoutBuilder::prologue() {
 //   - non-static fields are also sorted according to their contention group
 //     (support of the @Contended annotation)
 //   - @Contended annotation is ignored for static fields
+//
+// Sorting is purely by size (for footprint) and contention group; access
+// affinity is not considered, so fields that are hot together may end up
+// on different cache lines.  A profile-guided mode that clusters
+// co-accessed fields cannot be bolted on here: layout runs once at class
+// load, before any profile exists, and the offsets it assigns are
+// immediately baked into compiled code, CDS archives and the
+// serviceability agent.  Affinity-based packing therefore needs either
+// ahead-of-time profile input (a training run feeding the next launch)
+// or the full machinery to relayout and patch on the fly.  @Contended
+// remains the supported way to hand-place fields whose grouping is
+// known to matter.
 void FieldLayoutBuilder::regular_field_sorting() {
   for (AllFieldStream fs(_fields, _constant_pool); !fs.done(); fs.next()) {
     FieldGroup* group = NULL;
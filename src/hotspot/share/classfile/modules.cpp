@@ -269,6 +269,20 @@ void throw_dup_pkg_exception(const char* module_name, PackageEntry* package, TRA
   }
 }
 
+// Startup cost note: JVM_DefineModule is specified as one call per module, so
+// the boot layer arrives as ~70 separate calls from ModuleBootstrap and each
+// one takes Module_lock once.  The lock hold is already minimal — name
+// validation, symbol creation and the package-name checks all happen outside
+// it, and only the table inserts run locked — so a batch entry point taking
+// the whole layer would mostly save the per-call JNI transitions and lock
+// handoffs, at the price of a new JVM interface that java.base would have to
+// target.  The archived full module graph (define_archived_modules, below) is
+// the batch path that actually ships: with CDS it restores the entire boot
+// layer in one step and skips this routine for the common case.  Precomputing
+// a reads/exports adjacency matrix for verify_module_access is not viable
+// here because addReads/addExports mutate the graph after definition, so any
+// dense index would need invalidation on every add_module_to_reads/exports;
+// the existing per-entry lookup lists stay correct for free.
 void Modules::define_module(Handle module, jboolean is_open, jstring version,
                             jstring location, jobjectArray packages, TRAPS) {
   check_cds_restrictions(CHECK);
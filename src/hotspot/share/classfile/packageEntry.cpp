@@ -365,14 +365,12 @@ PackageEntry* PackageEntryTable::lookup(Symbol* name, ModuleEntry* module) {
   }
 }
 
+// Lock-free lookup, like ModuleEntryTable::lookup_only: entries are only
+// ever added at the bucket head (published with a release store, see
+// HashtableBucket::set_entry) and live until the table is deleted with
+// its ClassLoaderData, so readers need no lock.  Mutation still requires
+// the Module_lock.
 PackageEntry* PackageEntryTable::lookup_only(Symbol* name) {
-  assert(!Module_lock->owned_by_self(), "should not have the Module_lock - use locked_lookup_only");
-  MutexLocker ml(Module_lock);
-  return locked_lookup_only(name);
-}
-
-PackageEntry* PackageEntryTable::locked_lookup_only(Symbol* name) {
-  assert(Module_lock->owned_by_self(), "should have the Module_lock");
   int index = index_for(name);
   for (PackageEntry* p = bucket(index); p != NULL; p = p->next()) {
     if (p->name()->fast_compare(name) == 0) {
@@ -382,6 +380,11 @@ PackageEntry* PackageEntryTable::locked_lookup_only(Symbol* name) {
   return NULL;
 }
 
+PackageEntry* PackageEntryTable::locked_lookup_only(Symbol* name) {
+  assert(Module_lock->owned_by_self(), "should have the Module_lock");
+  return lookup_only(name);
+}
+
 // Called when a define module for java.base is being processed.
 // Verify the packages loaded thus far are in java.base's package list.
 void PackageEntryTable::verify_javabase_packages(GrowableArray<Symbol*> *pkg_list) {
@@ -291,11 +291,10 @@ public:
   PackageEntry* lookup(Symbol* name, ModuleEntry* module);
 
   // Only lookup Package within loader's package entry table.
-  // This will acquire the Module lock.
+  // This lookup is lock free and may run concurrently with additions.
   PackageEntry* lookup_only(Symbol* Package);
 
-  // Only lookup Package within loader's package entry table.  Assume Module lock
-  // was taken by caller.
+  // Same lookup for callers already holding the Module lock.
   PackageEntry* locked_lookup_only(Symbol* Package);
 
   void verify_javabase_packages(GrowableArray<Symbol*> *pkg_list);
@@ -319,6 +319,15 @@ oop StringTable::intern(const char* utf8_string, TRAPS) {
   return result;
 }
 
+// Workloads that intern the same small set of strings repeatedly might
+// benefit from a per-thread hash->oop memo consulted before the shared
+// table, but the table holds its strings only weakly: an interned string
+// with no other references is collected and its entry cleaned out, so a
+// thread-local cache would either resurrect stale oops or have to
+// register every cached slot as a GC root and be swept on cleaning.
+// Shared-archive strings from lookup_shared are the exception (they are
+// never collected), and that lookup is already the first, probe-free
+// check below.
 oop StringTable::intern(Handle string_or_null_h, const jchar* name, int len, TRAPS) {
   // shared table always uses java_lang_String::hash_code
   unsigned int hash = java_lang_String::hash_code(name, len);
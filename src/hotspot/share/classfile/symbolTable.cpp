@@ -449,6 +449,14 @@ Symbol* SymbolTable::lookup_only_unicode(const jchar* name, int utf16_length,
   }
 }
 
+// Batch interning entry point for the class file parser: the caller has
+// already hashed the names (in one pass over the constant pool) and
+// filtered out symbols present in the shared archive, so this loop only
+// pays for the table probes themselves.  The probes are issued one at a
+// time because ConcurrentHashTable offers no bulk insert and its
+// internal bucket layout can change under a concurrent resize, which is
+// also why pre-sorting the batch by bucket would not stay valid from
+// hashing to probing.
 void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHandle& cp,
                               int names_count, const char** names, int* lengths,
                               int* cp_indices, unsigned int* hashValues) {
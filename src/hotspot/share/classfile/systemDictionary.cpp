@@ -582,6 +582,18 @@ void SystemDictionary::post_class_load_event(EventClassLoad* event, const Instan
 // whether the thread must wait for loading in parallel.  It eventually calls load_instance_class,
 // which will load the class via the bootstrap loader or call ClassLoader.loadClass().
 // This can return NULL, an exception or an InstanceKlass.
+//
+// Failed lookups are deliberately not cached here.  For repeated misses
+// (frameworks probing optional classes on every request) most of the
+// cost is in the Java-level loadClass search, and short-circuiting that
+// from the VM would skip user loader code whose side effects and
+// exception choice are observable — whether a name resolves can
+// legitimately change whenever the loader's search path or delegation
+// answers change, which the VM cannot see.  Where the spec does permit
+// sticky failure — resolution through a constant pool entry — the
+// result is already memoized in the resolution_errors table, so the
+// supported fix for hot miss paths is to resolve through a cp entry or
+// cache the miss on the Java side.
 InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
                                                                 Handle class_loader,
                                                                 Handle protection_domain,
@@ -765,6 +777,14 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
 // _dictionary->bucket(index) is read here, so the caller will not see
 // the new entry.
 
+// This fast path takes no locks: Dictionary::find probes the loader's
+// dictionary with acquire-ordered bucket reads, so repeated resolution
+// of already-loaded names costs one hash plus a short chain walk.  A
+// separate (name, loader) -> Klass memo consulted before the dictionary
+// would be doing the same hashed probe against a second table while
+// adding its own unload invalidation, so the dictionary itself is kept
+// as the memo; if probes show up in profiles the lever is dictionary
+// sizing (see Dictionary resizing) rather than another cache in front.
 InstanceKlass* SystemDictionary::find_instance_klass(Symbol* class_name,
                                                      Handle class_loader,
                                                      Handle protection_domain) {
@@ -619,6 +619,18 @@ TypeOrigin ClassVerifier::ref_ctx(const char* sig) {
 }
 
 
+// Methods are verified sequentially on the loading thread.  The checks
+// for distinct methods are logically independent, but fanning them out
+// to workers is blocked by more than the shared method_signatures_table:
+// assignability checks load and resolve classes through Java-level
+// loader code (which is how recursive re-verification of this very
+// class can happen, see was_recursively_verified), so each worker would
+// need to be a JavaThread able to run arbitrary loader code, and a
+// VerifyError must surface as an exception on the requesting thread
+// with the first failing method winning.  For classes with thousands of
+// methods the parse-time StackMapTable makes each method check linear,
+// so the sequential cost is bounded by class size rather than being
+// quadratic.
 void ClassVerifier::verify_class(TRAPS) {
   log_info(verification)("Verifying class %s with new format", _klass->external_name());
 
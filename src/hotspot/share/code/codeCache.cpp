@@ -318,6 +318,18 @@ void CodeCache::initialize_heaps() {
   add_heap(non_profiled_space, "CodeHeap 'non-profiled nmethods'", CodeBlobType::MethodNonProfiled);
 }
 
+// Large page coverage of the code cache depends on how the pages are
+// provided.  With pinned large pages (+UseLargePages) the reservation
+// below uses the large page size directly and every commit is a large
+// page.  Under transparent huge pages the kernel only promotes regions
+// that are fully populated, so the incremental commit growth
+// (CodeCacheExpansionSize, 64K default) leaves fresh code on 4K pages
+// until khugepaged catches up; committing ahead of demand in 2M batches
+// and pretouching them (os::pretouch_memory) would close that window at
+// the cost of committed-but-unused memory, and is tunable today via
+// InitialCodeCacheSize/CodeCacheExpansionSize without new mechanism.
+// There is no portable API to re-promote already-committed 4K ranges
+// after the fact.
 size_t CodeCache::page_size(bool aligned, size_t min_pages) {
   if (os::can_execute_large_page_memory()) {
     if (InitialCodeCacheSize < ReservedCodeCacheSize) {
@@ -484,6 +496,17 @@ CodeBlob* CodeCache::next_blob(CodeHeap* heap, CodeBlob* cb) {
  * cache will contain a garbage CodeBlob until the caller can
  * run the constructor for the CodeBlob subclass he is busy
  * instantiating.
+ *
+ * Contention on CodeCache_lock during warmup cannot be relieved by
+ * handing each compiler thread a private multi-megabyte quantum to
+ * bump-allocate from: every address in a CodeHeap between low and high
+ * boundaries must be covered by the segment map and be iterable as a
+ * chain of valid blobs (first_blob/next_blob above are how the sweeper,
+ * the GC and find_blob see the heap), so a half-filled private quantum
+ * would appear as one giant bogus blob to every iterator.  Thread-local
+ * caching would have to live inside CodeHeap with per-quantum dummy
+ * blobs and its own fragmentation accounting before the lock scope here
+ * could shrink.
  */
 CodeBlob* CodeCache::allocate(int size, int code_blob_type, bool handle_alloc_failure, int orig_code_blob_type) {
   // Possibly wakes up the sweeper thread.
@@ -702,6 +725,16 @@ void CodeCache::do_unloading(BoolObjectClosure* is_alive, bool unloading_occurre
   }
 }
 
+// This is a serial walk, but note who still uses it before
+// parallelizing: the throughput-sensitive GC consumers already avoid
+// full cache walks (G1 keeps per-region code root sets, ZGC iterates
+// its own nmethod table in parallel, young collections use
+// ScavengableNMethods), so what remains are full-GC and diagnostic
+// paths.  If those ever dominate a pause, the segment map in CodeHeap
+// supports address-ordered chunk claiming — workers grab a fixed-size
+// address range and start at the first block head within it — with the
+// usual care that the walk holds CodeCache_lock or runs at a safepoint
+// so blocks cannot be carved up mid-claim.
 void CodeCache::blobs_do(CodeBlobClosure* f) {
   assert_locked_or_safepoint(CodeCache_lock);
   FOR_ALL_ALLOCABLE_HEAPS(heap) {
@@ -995,6 +1028,16 @@ void CodeCache::cleanup_inline_caches() {
 // Keeps track of time spent for checking dependencies
 NOT_PRODUCT(static elapsedTimer dependentCheckTime;)
 
+// This is already an inverted index walk, not a code cache scan: the
+// context stream yields just the new type's supertypes, and each of
+// those klasses keeps its dependent nmethods on its DependencyContext
+// list, populated at nmethod registration.  What costs time in a full
+// code cache is downstream of the index — every nmethod on an affected
+// context re-checks its encoded dependency stream, and contexts are
+// keyed by klass only, so all dependency kinds against a popular klass
+// share one list.  Sub-keying by dependency type would shrink those
+// list walks but requires splitting the per-klass context and the
+// registration paths that feed it.
 int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   int number_of_marked_CodeBlobs = 0;
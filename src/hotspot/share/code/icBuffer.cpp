@@ -140,7 +140,8 @@ void ICStub::print() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  _buffer = new StubQueue(new ICStubInterface, (int)InlineCacheBufferSize,
+                          InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
 }
 
@@ -155,7 +156,13 @@ void InlineCacheBuffer::refill_ic_stubs() {
   ICRefillVerifier* verifier = current_ic_refill_verifier();
   verifier->request_remembered();
 #endif
-  // we ran out of inline cache buffer space; must enter safepoint.
+  // We ran out of inline cache buffer space; must enter safepoint.
+  // A stub can only be reclaimed once no thread can be executing it
+  // and its IC site has been re-pointed, which update_inline_caches
+  // establishes for all stubs at once at the safepoint; reclaiming
+  // per-stub via handshakes instead would need each ICStub to track
+  // its transition state.  Until then, InlineCacheBufferSize bounds
+  // how often this safepoint is taken.
   // We do this by forcing a safepoint
   VM_ICBufferFull ibf;
   VMThread::execute(&ibf);
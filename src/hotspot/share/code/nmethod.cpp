@@ -2145,6 +2145,16 @@ static PcDesc* linear_search(const PcDescSearch& search, int pc_offset, bool app
 
 
 // Finds a PcDesc with real-pc equal to "pc"
+//
+// The miss path below is already sublinear: scopes_pcs is sorted by
+// pc_offset and searched with a fixed-radix narrowing from the last hit,
+// so no linear stream scan is involved in locating the PcDesc itself.
+// What profilers pay for on a cache miss is decoding the scope behind
+// the PcDesc — ScopeDescs are rebuilt from the compressed stream each
+// time and are resource-allocated, so they die with the caller's
+// ResourceMark.  Retaining decoded scopes for hot pcs would mean giving
+// them a C-heap lifetime owned by the nmethod and flushing them with it;
+// enlarging PcDescCache only helps the locate step, not the decode.
 PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, const PcDescSearch& search) {
   address base_address = search.code_begin();
   if ((pc < base_address) ||
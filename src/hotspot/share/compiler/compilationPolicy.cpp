@@ -610,6 +610,17 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
 }
 
 // Called with the queue locked and with at least one element
+//
+// The linear scan below is hard to replace with an indexed priority
+// structure: a task's priority is its method's event rate, which decays
+// with time and is recomputed by update_rate for every queued task on
+// every selection, so a heap or skiplist keyed on rate is stale as soon
+// as it is built.  The same pass also detects unloaded and timed-out
+// tasks and unlinks them, which keeps the queue bounded under load.
+// Making selection sublinear means first making priorities stable
+// between selections (e.g. decaying them in place on a coarse clock) so
+// an ordered structure only needs reheapification for the tasks whose
+// rate actually changed.
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
@@ -854,6 +865,13 @@ bool CompilationPolicy::is_old(Method* method) {
   return method->invocation_count() > 50000 || method->backedge_count() > 500000;
 }
 
+// The weight is a proxy for the expected payoff of compiling the method
+// now: the decaying event rate captures current hotness and the absolute
+// counts capture accumulated importance, with backedges weighing loops.
+// It deliberately ignores compile cost (method size) and profile
+// maturity; folding those in, or learning per-method thresholds from
+// observed tier-3 versus tier-4 performance, changes warmup ordering for
+// every workload and must be justified by benchmarking, not reasoning.
 double CompilationPolicy::weight(Method* method) {
   return (double)(method->rate() + 1) *
     (method->invocation_count() + 1) * (method->backedge_count() + 1);
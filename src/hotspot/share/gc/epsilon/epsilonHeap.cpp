@@ -37,6 +37,7 @@
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -105,6 +106,16 @@ EpsilonHeap* EpsilonHeap::heap() {
   return named_heap<EpsilonHeap>(CollectedHeap::Epsilon);
 }
 
+int EpsilonHeap::alloc_histogram_bucket(size_t size) {
+  assert(size > 0, "Allocation size should be positive: " SIZE_FORMAT, size);
+  return MIN2(log2i(size), alloc_histogram_buckets - 1);
+}
+
+size_t EpsilonHeap::alloc_histogram_at(int bucket) const {
+  assert(0 <= bucket && bucket < alloc_histogram_buckets, "Bucket should be in range: %d", bucket);
+  return Atomic::load(&_alloc_histogram[bucket]);
+}
+
 HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
   assert(is_object_aligned(size), "Allocation size should be aligned: " SIZE_FORMAT, size);
 
@@ -148,6 +159,8 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
     }
   }
 
+  Atomic::inc(&_alloc_histogram[alloc_histogram_bucket(size)]);
+
   size_t used = _space->used();
 
   // Allocation successful, update counters
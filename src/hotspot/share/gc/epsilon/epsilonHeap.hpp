@@ -48,12 +48,24 @@ private:
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
 
+public:
+  // Histogram of sizes passed to allocate_work, in power-of-two word-size
+  // buckets.  allocate_work is only called for TLAB refills and out-of-TLAB
+  // allocations, so recording every call is cheap.
+  static const int alloc_histogram_buckets = 32;
+
+private:
+  volatile size_t _alloc_histogram[alloc_histogram_buckets];
+
+  static int alloc_histogram_bucket(size_t size);
+
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap", ""),
-          _space(NULL) {};
+          _space(NULL),
+          _alloc_histogram() {};
 
   virtual Name kind() const {
     return CollectedHeap::Epsilon;
@@ -89,6 +101,7 @@ public:
 
   // Allocation
   HeapWord* allocate_work(size_t size, bool verbose = true);
+  size_t alloc_histogram_at(int bucket) const;
   virtual HeapWord* mem_allocate(size_t size, bool* gc_overhead_limit_was_exceeded);
   virtual HeapWord* allocate_new_tlab(size_t min_size,
                                       size_t requested_size,
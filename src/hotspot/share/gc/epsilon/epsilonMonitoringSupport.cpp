@@ -31,6 +31,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/perfData.hpp"
 #include "services/memoryService.hpp"
+#include "utilities/ostream.hpp"
 
 class EpsilonSpaceCounters: public CHeapObj<mtGC> {
   friend class VMStructs;
@@ -38,6 +39,7 @@ class EpsilonSpaceCounters: public CHeapObj<mtGC> {
 private:
   PerfVariable* _capacity;
   PerfVariable* _used;
+  PerfVariable* _alloc_histogram[EpsilonHeap::alloc_histogram_buckets];
   char*         _name_space;
 
 public:
@@ -69,6 +71,15 @@ public:
 
       cname = PerfDataManager::counter_name(_name_space, "initCapacity");
       PerfDataManager::create_constant(SUN_GC, cname, PerfData::U_Bytes, initial_capacity, CHECK);
+
+      // Allocation size histogram; bucket N counts allocations of
+      // [2^N, 2^(N+1)) words, the last bucket counts everything above.
+      for (int i = 0; i < EpsilonHeap::alloc_histogram_buckets; i++) {
+        stringStream ss;
+        ss.print("allocSizeBucket%d", i);
+        cname = PerfDataManager::counter_name(_name_space, ss.as_string());
+        _alloc_histogram[i] = PerfDataManager::create_variable(SUN_GC, cname, PerfData::U_Events, (jlong)0, CHECK);
+      }
     }
   }
 
@@ -80,6 +91,12 @@ public:
     _capacity->set_value(capacity);
     _used->set_value(used);
   }
+
+  inline void update_alloc_histogram(EpsilonHeap* heap) {
+    for (int i = 0; i < EpsilonHeap::alloc_histogram_buckets; i++) {
+      _alloc_histogram[i]->set_value((jlong)heap->alloc_histogram_at(i));
+    }
+  }
 };
 
 class EpsilonGenerationCounters : public GenerationCounters {
@@ -110,6 +127,7 @@ void EpsilonMonitoringSupport::update_counters() {
     size_t capacity = heap->capacity();
     _heap_counters->update_all();
     _space_counters->update_all(capacity, used);
+    _space_counters->update_alloc_histogram(heap);
     MetaspaceCounters::update_performance_counters();
   }
 }
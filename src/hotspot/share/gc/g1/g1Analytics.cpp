@@ -225,6 +225,15 @@ void G1Analytics::report_rs_length(double rs_length) {
   _rs_length_seq->add(rs_length);
 }
 
+// Predictions here are backward-looking by construction: a truncated
+// sequence of observed rates plus decayed confidence.  An external
+// pacing hint ("a burst of roughly X MB/s starts now", via jcmd or an
+// MXBean) could be blended in as a temporary floor on this prediction —
+// the seq stays authoritative, the hint only expires or is confirmed by
+// observations — which would let the policy start marking or expand
+// eden before the first stalled allocation rather than after.  The API
+// surface (hint lifetime, units, misuse bounding) is the hard part, not
+// this function; a hint that lies should at worst waste one early cycle.
 double G1Analytics::predict_alloc_rate_ms() const {
   return predict_zero_bounded(_alloc_rate_ms_seq);
 }
@@ -108,6 +108,14 @@ void G1BarrierSet::write_ref_field_post_slow(volatile CardValue* byte) {
   }
 }
 
+// Bulk stores (arraycopy, clone) land here once per operation, not per
+// element: the destination card range is walked in a single pass,
+// young and already-dirty cards are skipped, and only the remaining
+// cards are dirtied and enqueued.  The per-card queue entries are the
+// residual cost for huge arrays; folding them into one range record
+// would need the refinement side (G1DirtyCardQueueSet consumers) to
+// understand a second entry kind, and mostly helps exactly the copies
+// whose cards the skip-loop already finds dirty on repeat traffic.
 void G1BarrierSet::invalidate(MemRegion mr) {
   if (mr.is_empty()) {
     return;
@@ -153,5 +153,7 @@ class G1CardCountsClearClosure : public HeapRegionClosure {
 void G1CardCounts::clear_all() {
   assert(SafepointSynchronize::is_at_safepoint(), "don't call this otherwise");
   G1CardCountsClearClosure cl(this);
-  _g1h->heap_region_iterate(&cl);
+  // Clearing count ranges of different regions is independent, so let the
+  // workers claim regions in parallel.
+  _g1h->par_heap_region_iterate(&cl);
 }
@@ -67,6 +67,20 @@ bool G1CardSetFreeMemoryTask::calculate_return_infos(jlong deadline) {
     _return_info->append(new G1ReturnMemoryProcessor(return_to_vm_size));
   }
 
+  // Report the overall card set footprint and its fragmentation, i.e. how much
+  // of the memory committed for card sets sits unused in the free pool. This
+  // allows monitoring of remembered set footprint over time in long-running
+  // services.
+  size_t total_used = 0;
+  size_t total_free = 0;
+  for (uint i = 0; i < used.num_pools(); i++) {
+    total_used += used._num_mem_sizes[i];
+    total_free += free._num_mem_sizes[i];
+  }
+  log_debug(gc, task)("Card Set Free Memory: Total Used: %zu Free: %zu Fragmentation: %1.2f%%",
+                      total_used, total_free,
+                      percent_of(total_free, total_used + total_free));
+
   G1CardSetFreePool::update_unlink_processors(_return_info);
   return false;
 }
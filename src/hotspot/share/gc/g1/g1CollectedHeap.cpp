@@ -310,6 +310,20 @@ size_t G1CollectedHeap::humongous_obj_size_in_regions(size_t word_size) {
 // If could fit into free regions w/o expansion, try.
 // Otherwise, if can expand, do so.
 // Otherwise, if using ex regions might help, try with ex given back.
+//
+// Size-class freelists for humongous allocation would not address what
+// actually hurts here.  All regions are one grain, so a "size class" is
+// just a region count, and the expensive part of allocate_humongous() is
+// finding *contiguous* free regions - a property a freed range loses the
+// moment any of its regions is handed out for eden, and one that cannot
+// be cached unless freed humongous ranges are withheld from the general
+// free list, which shrinks the young gen to reserve address space for a
+// size that may never recur.  Reuse is also not deferred to cleanup:
+// eagerly reclaimed humongous regions (see G1EagerReclaimHumongousObjects)
+// go back on the free list at the end of the young pause that frees
+// them.  When identically-sized buffers churn, the effective fix is
+// raising G1HeapRegionSize so they stop being humongous and flow through
+// PLAB allocation, rather than teaching the region manager size classes.
 HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
   assert_heap_locked_or_at_safepoint(true /* should_be_vm_thread */);
 
@@ -2288,6 +2302,28 @@ void G1CollectedHeap::keep_alive(oop obj) {
   G1BarrierSet::enqueue(obj);
 }
 
+class G1ParHeapRegionIterateTask : public WorkerTask {
+  G1CollectedHeap* _g1h;
+  HeapRegionClosure* _cl;
+  HeapRegionClaimer _claimer;
+
+public:
+  G1ParHeapRegionIterateTask(G1CollectedHeap* g1h, HeapRegionClosure* cl) :
+    WorkerTask("G1 Parallel Region Iteration"),
+    _g1h(g1h),
+    _cl(cl),
+    _claimer(g1h->workers()->active_workers()) {}
+
+  void work(uint worker_id) {
+    _g1h->heap_region_par_iterate_from_worker_offset(_cl, &_claimer, worker_id);
+  }
+};
+
+void G1CollectedHeap::par_heap_region_iterate(HeapRegionClosure* cl) {
+  G1ParHeapRegionIterateTask task(this, cl);
+  workers()->run_task(&task);
+}
+
 void G1CollectedHeap::heap_region_iterate(HeapRegionClosure* cl) const {
   _hrm.iterate(cl);
 }
@@ -1113,6 +1113,11 @@ public:
   void heap_region_par_iterate_from_start(HeapRegionClosure* cl,
                                           HeapRegionClaimer* hrclaimer) const;
 
+  // Apply the given closure to all regions using the workers, handling region
+  // claiming internally. The closure must be safe to be applied to different
+  // regions by multiple workers concurrently.
+  void par_heap_region_iterate(HeapRegionClosure* cl);
+
   // Iterate over all regions in the collection set in parallel.
   void collection_set_par_iterate_all(HeapRegionClosure* cl,
                                       HeapRegionClaimer* hr_claimer,
@@ -671,13 +671,15 @@ private:
   G1ClearBitmapHRClosure _cl;
   HeapRegionClaimer _hr_claimer;
   bool _suspendible; // If the task is suspendible, workers must join the STS.
+  size_t _num_chunks; // Number of bitmap chunks to clear, in units of chunk_size().
 
 public:
-  G1ClearBitMapTask(G1ConcurrentMark* cm, uint n_workers, bool suspendible) :
+  G1ClearBitMapTask(G1ConcurrentMark* cm, uint n_workers, bool suspendible, size_t num_chunks) :
     WorkerTask("G1 Clear Bitmap"),
     _cl(cm, suspendible),
     _hr_claimer(n_workers),
-    _suspendible(suspendible)
+    _suspendible(suspendible),
+    _num_chunks(num_chunks)
   { }
 
   void work(uint worker_id) {
@@ -685,9 +687,21 @@ public:
     G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&_cl, &_hr_claimer, worker_id);
   }
 
-  bool is_complete() {
+  bool is_complete() const {
     return _cl.is_complete();
   }
+
+  // Regions are claimed dynamically, so running with fewer workers than
+  // requested only makes the clearing take longer.
+  bool workers_are_hint() const override {
+    return true;
+  }
+
+  size_t processed_work_units() const override {
+    // A yielded clear is restarted later; do not feed partial runs into
+    // the scalability learning.
+    return is_complete() ? _num_chunks : 0;
+  }
 };
 
 void G1ConcurrentMark::clear_next_bitmap(WorkerThreads* workers, bool may_yield) {
@@ -698,7 +712,7 @@ void G1ConcurrentMark::clear_next_bitmap(WorkerThreads* workers, bool may_yield)
 
   uint const num_workers = (uint)MIN2(num_chunks, (size_t)workers->active_workers());
 
-  G1ClearBitMapTask cl(this, num_workers, may_yield);
+  G1ClearBitMapTask cl(this, num_workers, may_yield, num_chunks);
 
   log_debug(gc, ergo)("Running %s with %u workers for " SIZE_FORMAT " work units.", cl.name(), num_workers, num_chunks);
   workers->run_task(&cl, num_workers);
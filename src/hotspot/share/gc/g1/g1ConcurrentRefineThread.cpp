@@ -94,6 +94,23 @@ bool G1ConcurrentRefineThread::maybe_deactivate(bool more_work) {
   }
 }
 
+bool G1ConcurrentRefineThread::spin_before_deactivate() {
+  assert(this == Thread::current(), "precondition");
+  // Under bursty allocation the queue often refills within microseconds of
+  // draining below the deactivation threshold. Spin for a short while before
+  // paying for the semaphore park/unpark round trip; this avoids activation
+  // ping-pong between mutators and refinement threads.
+  const uint max_spin_iterations = 64;
+  size_t activation = _cr->activation_threshold(_worker_id);
+  for (uint i = 0; i < max_spin_iterations; i++) {
+    if (G1BarrierSet::dirty_card_queue_set().num_cards() > activation) {
+      return true;
+    }
+    SpinPause();
+  }
+  return false;
+}
+
 void G1ConcurrentRefineThread::run_service() {
   _vtime_start = os::elapsedVTime();
 
@@ -126,7 +143,7 @@ void G1ConcurrentRefineThread::run_service() {
         }
 
         bool more_work = _cr->do_refinement_step(_worker_id, _refinement_stats);
-        if (maybe_deactivate(more_work)) break;
+        if (maybe_deactivate(more_work) && !spin_before_deactivate()) break;
       }
     }
 
@@ -62,6 +62,10 @@ class G1ConcurrentRefineThread: public ConcurrentGCThread {
   // Returns true if should deactivate.
   bool maybe_deactivate(bool more_work);
 
+  // Briefly spin re-checking the dirty card queue before parking the thread.
+  // Returns true if new work showed up during the spin.
+  bool spin_before_deactivate();
+
   G1ConcurrentRefine* _cr;
 
   void wait_for_completed_buffers();
@@ -27,7 +27,8 @@
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1SegmentedArray.inline.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
-#include "utilities/quickSort.hpp"
+#include "memory/resourceArea.hpp"
+#include "utilities/bitMap.inline.hpp"
 
 
 const G1SegmentedArrayAllocOptions G1EvacFailureObjectsSet::_alloc_options =
@@ -61,61 +62,65 @@ G1EvacFailureObjectsSet::G1EvacFailureObjectsSet(uint region_idx, HeapWord* bott
   assert(HeapRegion::LogOfHRGrainBytes < 32, "must be");
 }
 
-// Helper class to join, sort and iterate over the previously collected segmented
-// array of objects that failed evacuation.
-class G1EvacFailureObjectsIterationHelper {
+// Helper class to iterate in increasing address order over the previously
+// collected segmented array of objects that failed evacuation. The unordered
+// offsets are transferred into a bitmap over the region; iterating over the
+// set bits visits the failed objects in address order and deduplicates for
+// free, avoiding the join-and-sort of the raw offsets.
+class G1EvacFailureObjectsIterationHelper : public BitMapClosure {
   typedef G1EvacFailureObjectsSet::OffsetInRegion OffsetInRegion;
 
   G1EvacFailureObjectsSet* _objects_set;
   const G1SegmentedArray<OffsetInRegion, mtGC>* _segments;
-  OffsetInRegion* _offset_array;
-  uint _array_length;
+  CHeapBitMap _marked;
+  ObjectClosure* _closure;
+  DEBUG_ONLY(uint _num_marked;)
 
-  static int order_oop(OffsetInRegion a, OffsetInRegion b) {
-    return static_cast<int>(a-b);
-  }
-
-  void join_and_sort() {
-    _segments->iterate_nodes(*this);
-
-    QuickSort::sort(_offset_array, _array_length, order_oop, true);
-  }
-
-  void iterate(ObjectClosure* closure) {
-    for (uint i = 0; i < _array_length; i++) {
-      oop cur = _objects_set->from_offset(_offset_array[i]);
-      closure->do_object(cur);
-    }
+  static size_t max_offset() {
+    return (size_t)1 << (HeapRegion::LogOfHRGrainBytes - LogHeapWordSize);
   }
 
 public:
   G1EvacFailureObjectsIterationHelper(G1EvacFailureObjectsSet* collector) :
     _objects_set(collector),
     _segments(&_objects_set->_offsets),
-    _offset_array(nullptr),
-    _array_length(0) { }
+    _marked(max_offset(), mtGC),
+    _closure(nullptr)
+    DEBUG_ONLY(COMMA _num_marked(0)) { }
 
   void process_and_drop(ObjectClosure* closure) {
-    uint num = _segments->num_allocated_nodes();
-    _offset_array = NEW_C_HEAP_ARRAY(OffsetInRegion, num, mtGC);
+    DEBUG_ONLY(uint num = _segments->num_allocated_nodes();)
 
-    join_and_sort();
-    assert(_array_length == num, "must be %u, %u", _array_length, num);
-    iterate(closure);
+    _segments->iterate_nodes(*this);
+    assert(_num_marked == num, "must be %u, %u", _num_marked, num);
 
-    FREE_C_HEAP_ARRAY(OffsetInRegion, _offset_array);
+    _closure = closure;
+    _marked.iterate(this);
   }
 
   // Callback of G1SegmentedArray::iterate_nodes
   void do_buffer(G1SegmentedArrayBuffer<mtGC>* node, uint length) {
-    node->copy_to(&_offset_array[_array_length]);
-    _array_length += length;
+    OffsetInRegion* offsets = NEW_RESOURCE_ARRAY(OffsetInRegion, length);
+    node->copy_to(offsets);
+    for (uint i = 0; i < length; i++) {
+      assert(!_marked.at(offsets[i]), "object at offset %u recorded twice", offsets[i]);
+      _marked.set_bit(offsets[i]);
+    }
+    DEBUG_ONLY(_num_marked += length;)
+  }
+
+  // Callback of BitMap::iterate
+  bool do_bit(BitMap::idx_t offset) {
+    oop cur = _objects_set->from_offset(static_cast<OffsetInRegion>(offset));
+    _closure->do_object(cur);
+    return true;
   }
 };
 
 void G1EvacFailureObjectsSet::process_and_drop(ObjectClosure* closure) {
   assert_at_safepoint();
 
+  ResourceMark rm;
   G1EvacFailureObjectsIterationHelper helper(this);
   helper.process_and_drop(closure);
 
@@ -88,6 +88,18 @@ G1FullGCAdjustTask::G1FullGCAdjustTask(G1FullCollector* collector) :
   ClassLoaderDataGraph::clear_claimed_marks();
 }
 
+// A note on worker balance.  The adjust phase itself is dynamically
+// balanced: regions are claimed one at a time through the shared
+// HeapRegionClaimer, so a worker that drew dense regions simply claims
+// fewer of them, and skew is bounded by the cost of the single densest
+// region (humongous regions are split above for the same reason).  The
+// skew observed in full GC logs typically originates in the compact
+// phase instead, where the prepare phase distributes regions to
+// per-worker G1FullGCCompactionPoints without weighting by live bytes.
+// Rebalancing that by marking-known liveness is possible in prepare, but
+// only there: once forwarding addresses are installed, a compaction
+// point's regions form an ordered stream whose destinations are fixed,
+// so work cannot migrate between workers after the fact.
 void G1FullGCAdjustTask::work(uint worker_id) {
   Ticks start = Ticks::now();
   ResourceMark rm;
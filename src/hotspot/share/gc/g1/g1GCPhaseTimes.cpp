@@ -545,6 +545,32 @@ void G1GCPhaseTimes::print(bool evacuation_failed) {
   if (_cur_verify_after_time_ms > 0.0) {
     debug_time("Verify After", _cur_verify_after_time_ms);
   }
+
+  log_folded_phases();
+}
+
+// Dump all per-worker phase data for this pause in folded-stack format,
+// suitable for direct consumption by flamegraph tooling without parsing
+// the human-readable phase tree above.
+void G1GCPhaseTimes::log_folded_phases() const {
+  LogTarget(Trace, gc, phases, stats) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  LogStream ls(lt);
+  for (int i = 0; i < GCParPhasesSentinel; i++) {
+    WorkerDataArray<double>* phase = _gc_par_phases[i];
+    if (phase == NULL) {
+      continue;
+    }
+    phase->print_folded_on(&ls, "gc-pause");
+    for (uint j = 0; j < WorkerDataArray<double>::MaxThreadWorkItems; j++) {
+      WorkerDataArray<size_t>* work_items = phase->thread_work_items(j);
+      if (work_items != NULL) {
+        work_items->print_folded_on(&ls, "gc-pause");
+      }
+    }
+  }
 }
 
 const char* G1GCPhaseTimes::phase_name(GCParPhases phase) {
@@ -215,6 +215,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   void debug_serial_phase(WorkerDataArray<double>* phase, uint extra_indent = 0) const;
   void debug_phase(WorkerDataArray<double>* phase, uint extra_indent = 0) const;
   void trace_phase(WorkerDataArray<double>* phase, bool print_sum = true, uint extra_indent = 0) const;
+  void log_folded_phases() const;
 
   void info_time(const char* name, double value) const;
   void debug_time(const char* name, double value) const;
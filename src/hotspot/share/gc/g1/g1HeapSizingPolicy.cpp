@@ -26,6 +26,7 @@
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1Analytics.hpp"
+#include "gc/g1/heapRegion.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
@@ -196,6 +197,15 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   return expand_bytes;
 }
 
+size_t G1HeapSizingPolicy::allocation_reserve_bytes() const {
+  // Cover roughly one second of predicted allocation. The allocation rate
+  // prediction already decays quickly after a burst, so this reserve only
+  // persists while bursts are recent. Align up to full regions.
+  const double reserve_time_ms = 1000.0;
+  size_t reserve_bytes = (size_t)(_analytics->predict_alloc_rate_ms() * reserve_time_ms);
+  return align_up(reserve_bytes, HeapRegion::GrainBytes);
+}
+
 static size_t target_heap_capacity(size_t used_bytes, uintx free_ratio) {
   const double desired_free_percentage = (double) free_ratio / 100.0;
   const double desired_used_percentage = 1.0 - desired_free_percentage;
@@ -253,6 +263,21 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
     // Capacity too large, compute shrinking size
     size_t shrink_bytes = capacity_after_gc - maximum_desired_capacity;
 
+    // Do not give back memory we will predictably need again shortly: retain
+    // enough committed-but-free space to absorb the forecast allocation burst.
+    // This dampens commit/uncommit oscillation on spiky workloads where the
+    // next burst would otherwise stall on os::commit_memory.
+    size_t reserve_bytes = allocation_reserve_bytes();
+    size_t free_bytes = capacity_after_gc - used_after_gc;
+    size_t max_shrink_bytes = (free_bytes > reserve_bytes) ? (free_bytes - reserve_bytes) : 0;
+    if (shrink_bytes > max_shrink_bytes) {
+      log_debug(gc, ergo, heap)("Limit heap shrinking to retain allocation reserve. "
+                                "Shrink: " SIZE_FORMAT "B limited to: " SIZE_FORMAT "B "
+                                "reserve: " SIZE_FORMAT "B",
+                                shrink_bytes, max_shrink_bytes, reserve_bytes);
+      shrink_bytes = max_shrink_bytes;
+    }
+
     log_debug(gc, ergo, heap)("Attempt heap shrinking (capacity higher than max desired capacity). "
                               "Capacity: " SIZE_FORMAT "B occupancy: " SIZE_FORMAT "B live: " SIZE_FORMAT "B "
                               "maximum_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%)",
@@ -49,6 +49,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // eagerly at small heap sizes.
   double scale_with_heap(double pause_time_threshold);
 
+  // Amount of committed-but-free memory to retain when shrinking, based on the
+  // predicted allocation rate, so that the next allocation burst does not stall
+  // on committing the regions back.
+  size_t allocation_reserve_bytes() const;
+
   G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 public:
 
@@ -357,6 +357,10 @@ private:
   bool             _par;
   VerifyOption     _vo;
   bool             _failures;
+  // With G1VerifyRegionInterval > 1 only regions with
+  // (index % interval) == _sample_offset are verified. The offset advances
+  // with the collection count so successive verifications cover the whole heap.
+  uint             _sample_offset;
 public:
   // _vo == UsePrevMarking -> use "prev" marking information,
   // _vo == UseNextMarking -> use "next" marking information,
@@ -364,13 +368,18 @@ public:
   VerifyRegionClosure(bool par, VerifyOption vo)
     : _par(par),
       _vo(vo),
-      _failures(false) {}
+      _failures(false),
+      _sample_offset(G1CollectedHeap::heap()->total_collections() % G1VerifyRegionInterval) {}
 
   bool failures() {
     return _failures;
   }
 
   bool do_heap_region(HeapRegion* r) {
+    if (G1VerifyRegionInterval > 1 &&
+        (r->hrm_index() % G1VerifyRegionInterval) != _sample_offset) {
+      return false;
+    }
     guarantee(!r->has_index_in_opt_cset(), "Region %u still has opt collection set index %u", r->hrm_index(), r->index_in_opt_cset());
     guarantee(!r->is_young() || r->rem_set()->is_complete(), "Remembered set for Young region %u must be complete, is %s", r->hrm_index(), r->rem_set()->get_state_str());
     // Humongous and old regions regions might be of any state, so can't check here.
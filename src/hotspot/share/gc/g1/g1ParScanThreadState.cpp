@@ -227,10 +227,17 @@ void G1ParScanThreadState::do_partial_array(PartialArrayScanTask task) {
   assert(to_obj->is_objArray(), "must be obj array");
   objArrayOop to_array = objArrayOop(to_obj);
 
+  const int chunk_size
+    = _partial_array_stepper.chunk_size(objArrayOop(from_obj)->length(),
+                                        _partial_objarray_chunk_size);
   PartialArrayTaskStepper::Step step
     = _partial_array_stepper.next(objArrayOop(from_obj),
                                   to_array,
-                                  _partial_objarray_chunk_size);
+                                  chunk_size);
+  // The claimed chunk may be cold if this task was stolen; start fetching
+  // it while the new tasks are pushed.
+  const size_t elem_size = UseCompressedOops ? sizeof(narrowOop) : sizeof(oop);
+  Prefetch::read(to_array->base(), step._index * elem_size);
   for (uint i = 0; i < step._ncreate; ++i) {
     push_on_queue(ScannerTask(PartialArrayScanTask(from_obj)));
   }
@@ -242,7 +249,7 @@ void G1ParScanThreadState::do_partial_array(PartialArrayScanTask task) {
   // on start/end.
   to_array->oop_iterate_range(&_scanner,
                               step._index,
-                              step._index + _partial_objarray_chunk_size);
+                              step._index + chunk_size);
 }
 
 MAYBE_INLINE_EVACUATION
@@ -257,10 +264,13 @@ void G1ParScanThreadState::start_partial_objarray(G1HeapRegionAttr dest_attr,
 
   objArrayOop to_array = objArrayOop(to_obj);
 
+  const int chunk_size
+    = _partial_array_stepper.chunk_size(objArrayOop(from_obj)->length(),
+                                        _partial_objarray_chunk_size);
   PartialArrayTaskStepper::Step step
     = _partial_array_stepper.start(objArrayOop(from_obj),
                                    to_array,
-                                   _partial_objarray_chunk_size);
+                                   chunk_size);
 
   // Push any needed partial scan tasks.  Pushed before processing the
   // intitial chunk to allow other workers to steal while we're processing.
@@ -293,6 +303,23 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task) {
   }
 }
 
+// Prefetch the object a queued task refers to. The first touch of the
+// to-be-evacuated object (mark word load in do_oop_evac) is typically a cache
+// miss, so start the fetch while still processing the previous task.
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::prefetch_task(ScannerTask task) {
+  oop obj;
+  if (task.is_narrow_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_narrow_oop_ptr());
+  } else if (task.is_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_oop_ptr());
+  } else {
+    // Partial array tasks touch the forwardee which is usually still cached.
+    return;
+  }
+  Prefetch::read(cast_from_oop<void*>(obj), 0);
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
@@ -305,7 +332,16 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
         dispatch_task(task);
       }
     }
-    while (_task_queue->pop_local(task, threshold)) {
+    // Software-pipelined variant of popping and dispatching one task at a
+    // time: pop the next task and prefetch its object before dispatching the
+    // current one.
+    if (_task_queue->pop_local(task, threshold)) {
+      ScannerTask next;
+      while (_task_queue->pop_local(next, threshold)) {
+        prefetch_task(next);
+        dispatch_task(task);
+        task = next;
+      }
       dispatch_task(task);
     }
   } while (!_task_queue->overflow_empty());
@@ -436,6 +472,21 @@ void G1ParScanThreadState::undo_allocation(G1HeapRegionAttr dest_attr,
 
 // Private inline function, for direct internal use and providing the
 // implementation of the public not-inline function.
+//
+// On promoting whole survivor regions in place instead of copying: the
+// copy is not only data movement.  Survivor regions carry no remembered
+// sets - they are unconditionally in the collection set, so nothing
+// tracks references into them - which means a region retyped to old at
+// pause start has no remset and would be invisible to later mixed
+// collections; one would have to either maintain remsets for candidate
+// survivor regions throughout their young life (paying refinement for
+// regions that mostly get copied anyway) or rebuild them with a heap
+// scan at retype time.  Retyping is also all-or-nothing per region while
+// tenuring is a per-object age decision, and the under-threshold minority
+// would tenure prematurely.  The cheaper existing lever for heavy-tenure
+// workloads is letting the objects skip survivor space entirely via the
+// adaptive threshold (see G1Policy's tenuring and the age table above),
+// which turns two copies into one without any remset surgery.
 MAYBE_INLINE_EVACUATION
 oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const region_attr,
                                                     oop const old,
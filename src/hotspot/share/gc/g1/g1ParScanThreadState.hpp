@@ -177,6 +177,7 @@ private:
   template <class T> void do_oop_evac(T* p);
 
   void dispatch_task(ScannerTask task);
+  void prefetch_task(ScannerTask task);
 
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. Previous_plab_refill_failed indicates whether previous
@@ -445,7 +445,12 @@ void G1Policy::record_full_collection_end() {
   // transitions and make sure we start with young GCs after the Full GC.
   collector_state()->set_in_young_only_phase(true);
   collector_state()->set_in_young_gc_before_mixed(false);
-  collector_state()->set_initiate_conc_mark_if_possible(need_to_start_conc_mark("end of Full GC"));
+  // The Full GC has dropped all remembered sets. With G1RebuildRemSetsAfterFullGC
+  // we unconditionally start a concurrent cycle here so that the remembered sets
+  // of the collection set candidate regions are rebuilt concurrently instead of
+  // lazily during the first mixed collection pauses.
+  collector_state()->set_initiate_conc_mark_if_possible(G1RebuildRemSetsAfterFullGC ||
+                                                        need_to_start_conc_mark("end of Full GC"));
   collector_state()->set_in_concurrent_start_gc(false);
   collector_state()->set_mark_or_rebuild_in_progress(false);
   collector_state()->set_clearing_next_bitmap(false);
@@ -29,6 +29,7 @@
 #include "gc/g1/g1CardSet.inline.hpp"
 #include "gc/g1/g1CardTable.inline.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
+#include "gc/g1/g1CardTableScanner.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
@@ -626,107 +627,6 @@ double G1RemSet::sampling_task_vtime() {
   return _sampling_task->vtime_accum();
 }
 
-// Helper class to scan and detect ranges of cards that need to be scanned on the
-// card table.
-class G1CardTableScanner : public StackObj {
-public:
-  typedef CardTable::CardValue CardValue;
-
-private:
-  CardValue* const _base_addr;
-
-  CardValue* _cur_addr;
-  CardValue* const _end_addr;
-
-  static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
-  static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
-
-  bool cur_addr_aligned() const {
-    return ((uintptr_t)_cur_addr) % sizeof(size_t) == 0;
-  }
-
-  bool cur_card_is_dirty() const {
-    CardValue value = *_cur_addr;
-    return (value & ToScanMask) == 0;
-  }
-
-  bool cur_word_of_cards_contains_any_dirty_card() const {
-    assert(cur_addr_aligned(), "Current address should be aligned");
-    size_t const value = *(size_t*)_cur_addr;
-    return (~value & ExpandedToScanMask) != 0;
-  }
-
-  bool cur_word_of_cards_all_dirty_cards() const {
-    size_t const value = *(size_t*)_cur_addr;
-    return value == G1CardTable::WordAllDirty;
-  }
-
-  size_t get_and_advance_pos() {
-    _cur_addr++;
-    return pointer_delta(_cur_addr, _base_addr, sizeof(CardValue)) - 1;
-  }
-
-public:
-  G1CardTableScanner(CardValue* start_card, size_t size) :
-    _base_addr(start_card),
-    _cur_addr(start_card),
-    _end_addr(start_card + size) {
-
-    assert(is_aligned(start_card, sizeof(size_t)), "Unaligned start addr " PTR_FORMAT, p2i(start_card));
-    assert(is_aligned(size, sizeof(size_t)), "Unaligned size " SIZE_FORMAT, size);
-  }
-
-  size_t find_next_dirty() {
-    while (!cur_addr_aligned()) {
-      if (cur_card_is_dirty()) {
-        return get_and_advance_pos();
-      }
-      _cur_addr++;
-    }
-
-    assert(cur_addr_aligned(), "Current address should be aligned now.");
-    while (_cur_addr != _end_addr) {
-      if (cur_word_of_cards_contains_any_dirty_card()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a dirty card in the word.");
-      }
-      _cur_addr += sizeof(size_t);
-    }
-    return get_and_advance_pos();
-  }
-
-  size_t find_next_non_dirty() {
-    assert(_cur_addr <= _end_addr, "Not allowed to search for marks after area.");
-
-    while (!cur_addr_aligned()) {
-      if (!cur_card_is_dirty()) {
-        return get_and_advance_pos();
-      }
-      _cur_addr++;
-    }
-
-    assert(cur_addr_aligned(), "Current address should be aligned now.");
-    while (_cur_addr != _end_addr) {
-      if (!cur_word_of_cards_all_dirty_cards()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (!cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a non-dirty card in the word.");
-      }
-      _cur_addr += sizeof(size_t);
-    }
-    return get_and_advance_pos();
-  }
-};
-
 // Helper class to claim dirty chunks within the card table.
 class G1CardTableChunkClaimer {
   G1RemSetScanState* _scan_state;
@@ -823,6 +723,17 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     _blocks_scanned++;
   }
 
+  // Dirty block discovery (card table lines) and oop scanning (heap
+  // lines) are interleaved here, so the access pattern alternates
+  // between the two.  A two-pass variant — batch the dirty ranges of a
+  // claimed chunk into a local array while prefetching their heap
+  // addresses, then scan — is compatible with this code because block
+  // order and the _scanned_to finger would be preserved, and the card
+  // value rewrite in do_card_block can stay in the discovery pass.  It
+  // was not adopted without data: the chunk claimer already keeps each
+  // worker within one region's card range, dirty blocks are often
+  // adjacent (one BOT walk covers them), and a batch that defers scans
+  // also defers trim_queue_partially, growing task queue peaks.
    void scan_heap_roots(HeapRegion* r) {
     EventGCPhaseParallel event;
     uint const region_idx = r->hrm_index();
@@ -101,6 +101,18 @@ static inline bool discard_entry(const void* entry, G1CollectedHeap* g1h) {
   return !requires_marking(entry, g1h) || g1h->is_marked_next(cast_to_oop(entry));
 }
 
+// Filtering is deliberately batched here rather than done per store in
+// the write barrier.  When a buffer fills, the filter pass compacts it in
+// one cache-friendly sweep, and only the survivors are handed to marking;
+// a duplicate or already-marked pre-value therefore costs a buffer slot,
+// not a marking step.  Moving suppression to enqueue time with a
+// probabilistic structure (e.g. a per-thread Bloom filter of recently
+// enqueued oops) is unsound for SATB: a false positive drops a pre-value
+// that was never actually recorded, the snapshot loses a live object, and
+// marking frees it.  Any enqueue-time check must be exact - effectively a
+// mark bitmap or TAMS load in the barrier itself - which trades buffer
+// slots for extra memory traffic on every reference store while marking
+// is active, the opposite of what a write-heavy workload wants.
 // Workaround for not yet having std::bind.
 class G1SATBMarkQueueFilterFn {
   G1CollectedHeap* _g1h;
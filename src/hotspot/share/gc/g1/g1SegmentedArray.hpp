@@ -91,6 +91,11 @@ public:
 // to it and removal of elements is strictly separate, but every action may be
 // performed by multiple threads at the same time.
 // Counts and memory usage are current on a best-effort basis if accessed concurrently.
+//
+// With UseNUMA the buffers are kept in per-node buckets indexed by the NUMA node
+// of the inserting thread, so that a buffer recycled by a thread is preferentially
+// handed back to a thread on the same node. Threads fall back to the other
+// buckets if their local bucket is empty.
 template<MEMFLAGS flag>
 class G1SegmentedArrayBufferList {
   static G1SegmentedArrayBuffer<flag>* volatile* next_ptr(G1SegmentedArrayBuffer<flag>& node) {
@@ -98,13 +103,20 @@ class G1SegmentedArrayBufferList {
   }
   typedef LockFreeStack<G1SegmentedArrayBuffer<flag>, &G1SegmentedArrayBufferList::next_ptr> NodeStack;
 
-  NodeStack _list;
+  // Maximum number of per-NUMA-node buckets; node indices are folded into this
+  // range. Must be a power of two. A single bucket is used unless UseNUMA.
+  static const uint MaxBuckets = 8;
+
+  NodeStack _lists[MaxBuckets];
 
   volatile size_t _num_buffers;
   volatile size_t _mem_size;
 
+  // Bucket preferred by the current thread, determined by its NUMA node.
+  static uint current_bucket();
+
 public:
-  G1SegmentedArrayBufferList() : _list(), _num_buffers(0), _mem_size(0) { }
+  G1SegmentedArrayBufferList() : _num_buffers(0), _mem_size(0) { }
   ~G1SegmentedArrayBufferList() { free_all(); }
 
   void bulk_add(G1SegmentedArrayBuffer<flag>& first, G1SegmentedArrayBuffer<flag>& last, size_t num, size_t mem_size);
@@ -28,6 +28,7 @@
 
 #include "gc/g1/g1SegmentedArray.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/globalCounter.inline.hpp"
 
 template<MEMFLAGS flag>
@@ -55,12 +56,21 @@ void* G1SegmentedArrayBuffer<flag>::get_new_buffer_elem() {
   return r;
 }
 
+template<MEMFLAGS flag>
+uint G1SegmentedArrayBufferList<flag>::current_bucket() {
+  if (!UseNUMA) {
+    return 0;
+  }
+  int node = os::numa_get_group_id();
+  return (node <= 0) ? 0 : ((uint)node & (MaxBuckets - 1));
+}
+
 template<MEMFLAGS flag>
 void G1SegmentedArrayBufferList<flag>::bulk_add(G1SegmentedArrayBuffer<flag>& first,
                                                 G1SegmentedArrayBuffer<flag>& last,
                                                 size_t num,
                                                 size_t mem_size) {
-  _list.prepend(first, last);
+  _lists[current_bucket()].prepend(first, last);
   Atomic::add(&_num_buffers, num, memory_order_relaxed);
   Atomic::add(&_mem_size, mem_size, memory_order_relaxed);
 }
@@ -75,7 +85,15 @@ template<MEMFLAGS flag>
 G1SegmentedArrayBuffer<flag>* G1SegmentedArrayBufferList<flag>::get() {
   GlobalCounter::CriticalSection cs(Thread::current());
 
-  G1SegmentedArrayBuffer<flag>* result = _list.pop();
+  // Prefer the bucket of the current thread's node, then steal from the others.
+  uint const start = current_bucket();
+  G1SegmentedArrayBuffer<flag>* result = nullptr;
+  for (uint i = 0; i < MaxBuckets; i++) {
+    result = _lists[(start + i) & (MaxBuckets - 1)].pop();
+    if (result != nullptr) {
+      break;
+    }
+  }
   if (result != nullptr) {
     Atomic::dec(&_num_buffers, memory_order_relaxed);
     Atomic::sub(&_mem_size, result->mem_size(), memory_order_relaxed);
@@ -88,7 +106,24 @@ G1SegmentedArrayBuffer<flag>* G1SegmentedArrayBufferList<flag>::get_all(size_t&
                                                                         size_t& mem_size) {
   GlobalCounter::CriticalSection cs(Thread::current());
 
-  G1SegmentedArrayBuffer<flag>* result = _list.pop_all();
+  // Chain the contents of all buckets together.
+  G1SegmentedArrayBuffer<flag>* result = nullptr;
+  G1SegmentedArrayBuffer<flag>* last = nullptr;
+  for (uint i = 0; i < MaxBuckets; i++) {
+    G1SegmentedArrayBuffer<flag>* cur = _lists[i].pop_all();
+    if (cur == nullptr) {
+      continue;
+    }
+    if (result == nullptr) {
+      result = cur;
+    } else {
+      last->set_next(cur);
+    }
+    last = cur;
+    while (last->next() != nullptr) {
+      last = last->next();
+    }
+  }
   num_buffers = Atomic::load(&_num_buffers);
   mem_size = Atomic::load(&_mem_size);
 
@@ -105,10 +140,12 @@ void G1SegmentedArrayBufferList<flag>::free_all() {
   size_t mem_size_freed = 0;
   G1SegmentedArrayBuffer<flag>* cur;
 
-  while ((cur = _list.pop()) != nullptr) {
-    mem_size_freed += cur->mem_size();
-    num_freed++;
-    delete cur;
+  for (uint i = 0; i < MaxBuckets; i++) {
+    while ((cur = _lists[i].pop()) != nullptr) {
+      mem_size_freed += cur->mem_size();
+      num_freed++;
+      delete cur;
+    }
   }
 
   Atomic::sub(&_num_buffers, num_freed, memory_order_relaxed);
@@ -133,6 +133,12 @@
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
                                                                             \
+  product(bool, G1RebuildRemSetsAfterFullGC, false, EXPERIMENTAL,           \
+               "Start a concurrent mark cycle right after a Full GC to "    \
+               "rebuild remembered sets of collection set candidate "       \
+               "regions concurrently instead of paying for that work in "   \
+               "the first mixed collection pauses.")                        \
+                                                                            \
   product(double, G1LastPLABAverageOccupancy, 50.0, EXPERIMENTAL,           \
                "The expected average occupancy of the last PLAB in "        \
                "percent.")                                                  \
@@ -332,6 +338,13 @@
   product(bool, G1VerifyHeapRegionCodeRoots, false, DIAGNOSTIC,             \
           "Verify the code root lists attached to each heap region.")       \
                                                                             \
+  product(uint, G1VerifyRegionInterval, 1, DIAGNOSTIC,                      \
+          "Verify only every n-th heap region during heap verification. "   \
+          "The set of verified regions rotates between verifications so "   \
+          "all regions are eventually covered. Allows lightweight "         \
+          "continuous verification in production-like instances.")          \
+          range(1, UINT_MAX)                                                \
+                                                                            \
   develop(bool, G1VerifyBitmaps, false,                                     \
           "Verifies the consistency of the marking bitmaps")                \
                                                                             \
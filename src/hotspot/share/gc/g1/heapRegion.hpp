@@ -644,7 +644,7 @@ public:
 
   // True after iteration if the closure was applied to all heap regions
   // and returned "false" in all cases.
-  bool is_complete() { return _is_complete; }
+  bool is_complete() const { return _is_complete; }
 };
 
 #endif // SHARE_GC_G1_HEAPREGION_HPP
@@ -241,9 +241,17 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
 
     CardValue* current_card = worker_start_card;
     while (current_card < worker_end_card) {
-      // Find an unclean card.
+      // Find an unclean card.  In a mostly-clean old gen the bulk of the
+      // stripe is clean spans, so once aligned, skip them a word's worth
+      // of cards at a time (cf. the non-clean card search in CardTableRS).
       while (current_card < worker_end_card && card_is_clean(*current_card)) {
         current_card++;
+        if (is_aligned(current_card, sizeof(intptr_t))) {
+          while (current_card + sizeof(intptr_t) <= worker_end_card &&
+                 *(const intptr_t*)current_card == clean_card_row_val()) {
+            current_card += sizeof(intptr_t);
+          }
+        }
       }
       CardValue* first_unclean_card = current_card;
 
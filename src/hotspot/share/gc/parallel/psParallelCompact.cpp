@@ -1433,17 +1433,41 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
-void PSParallelCompact::summarize_spaces_quick()
+void PSParallelCompact::summarize_space_quick(SpaceId id)
 {
-  for (unsigned int i = 0; i < last_space_id; ++i) {
-    const MutableSpace* space = _space_info[i].space();
-    HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), NULL,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
-    _space_info[i].set_dense_prefix(space->bottom());
+  const MutableSpace* space = _space_info[id].space();
+  HeapWord** nta = _space_info[id].new_top_addr();
+  bool result = _summary_data.summarize(_space_info[id].split_info(),
+                                        space->bottom(), space->top(), NULL,
+                                        space->bottom(), space->end(), nta);
+  assert(result, "space must fit into itself");
+  _space_info[id].set_dense_prefix(space->bottom());
+}
+
+class SummarizeSpacesQuickTask : public WorkerTask {
+private:
+  volatile uint _cur_space;
+
+public:
+  SummarizeSpacesQuickTask() :
+      WorkerTask("SummarizeSpacesQuickTask"),
+      _cur_space(0) {}
+
+  virtual void work(uint worker_id) {
+    // Spaces summarize into disjoint region data, so they can be claimed and
+    // processed independently.
+    for (uint id = Atomic::fetch_and_add(&_cur_space, 1u);
+         id < PSParallelCompact::last_space_id;
+         id = Atomic::fetch_and_add(&_cur_space, 1u)) {
+      PSParallelCompact::summarize_space_quick(PSParallelCompact::SpaceId(id));
+    }
   }
+};
+
+void PSParallelCompact::summarize_spaces_quick()
+{
+  SummarizeSpacesQuickTask task;
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
 }
 
 void PSParallelCompact::fill_dense_prefix_end(SpaceId id)
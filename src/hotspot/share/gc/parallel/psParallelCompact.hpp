@@ -1022,6 +1022,7 @@ class PSParallelCompact : AllStatic {
 
   friend class RefProcTaskProxy;
   friend class PSParallelCompactTest;
+  friend class SummarizeSpacesQuickTask;
 
  private:
   static STWGCTimer           _gc_timer;
@@ -1122,6 +1123,7 @@ class PSParallelCompact : AllStatic {
   static void fill_dense_prefix_end(SpaceId id);
 
   static void summarize_spaces_quick();
+  static void summarize_space_quick(SpaceId id);
   static void summarize_space(SpaceId id, bool maximum_compaction);
   static void summary_phase(ParCompactionManager* cm, bool maximum_compaction);
 
@@ -206,6 +206,8 @@ PSPromotionManager::PSPromotionManager() {
   // let's choose 1.5x the chunk size
   _min_array_size_for_chunking = 3 * _array_chunk_size / 2;
 
+  _numa_node = 0;
+
   _preserved_marks = NULL;
 
   reset();
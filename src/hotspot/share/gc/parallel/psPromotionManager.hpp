@@ -89,6 +89,10 @@ class PSPromotionManager {
   uint                                _array_chunk_size;
   uint                                _min_array_size_for_chunking;
 
+  // The NUMA node the owning worker was last seen running on. Used to
+  // prefer node-local victims when stealing.
+  uint                                _numa_node;
+
   PreservedMarks*                     _preserved_marks;
   PromotionFailedInfo                 _promotion_failed_info;
 
@@ -40,6 +40,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 
 inline PSPromotionManager* PSPromotionManager::manager_array(uint index) {
@@ -348,6 +349,26 @@ inline void PSPromotionManager::process_popped_location_depth(ScannerTask task)
 }
 
 inline bool PSPromotionManager::steal_depth(int queue_num, ScannerTask& t) {
+  if (UseNUMA) {
+    // Remember which node this worker runs on, so that other stealers can
+    // prefer node-local victims.
+    PSPromotionManager* const pm = manager_array((uint)queue_num);
+    pm->_numa_node = (uint)os::numa_get_group_id();
+
+    // Prefer victims on the same node: tasks stolen from a node-local queue
+    // mostly reference node-local objects, and the copies go into this
+    // worker's LABs, which MutableNUMASpace carves out node-locally. Fall
+    // back to random stealing when the local node is dry.
+    for (uint i = 1; i < ParallelGCThreads; i++) {
+      const uint k = ((uint)queue_num + i) % ParallelGCThreads;
+      PSPromotionManager* const victim = manager_array(k);
+      if (victim->_numa_node == pm->_numa_node &&
+          victim->claimed_stack_depth()->size() > 0 &&
+          stack_array_depth()->queue(k)->pop_global(t)) {
+        return true;
+      }
+    }
+  }
   return stack_array_depth()->steal(queue_num, t);
 }
 
@@ -111,6 +111,9 @@ protected:
   // a word's worth (row) of clean card values
   static const intptr_t clean_card_row = (intptr_t)(-1);
 
+  // a word's worth (row) of dirty card values
+  static const intptr_t dirty_card_row = (intptr_t)0;
+
 public:
   CardTable(MemRegion whole_heap);
   virtual ~CardTable();
@@ -238,6 +241,7 @@ public:
   static constexpr CardValue clean_card_val()          { return clean_card; }
   static constexpr CardValue dirty_card_val()          { return dirty_card; }
   static intptr_t clean_card_row_val()   { return clean_card_row; }
+  static intptr_t dirty_card_row_val()   { return dirty_card_row; }
 
   // Card marking array base (adjusted for heap low boundary)
   // This would be the 0th element of _byte_map, if the heap started at 0x0.
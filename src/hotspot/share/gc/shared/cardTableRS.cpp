@@ -36,6 +36,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/macros.hpp"
 
 inline bool ClearNoncleanCardWrapper::clear_card(CardValue* entry) {
@@ -67,10 +68,25 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
   HeapWord* start_of_non_clean = end_of_non_clean;
   while (cur_entry >= limit) {
     HeapWord* cur_hw = _ct->addr_for(cur_entry);
+    // The scan runs right to left; prefetch the heap words under the cards
+    // we are about to examine.
+    Prefetch::read(cur_hw, -PrefetchScanIntervalInBytes);
     if ((*cur_entry != CardTableRS::clean_card_val()) && clear_card(cur_entry)) {
       // Continue the dirty range by opening the
       // dirty window one card to the left.
       start_of_non_clean = cur_hw;
+
+      // fast forward through potential continuous whole-word range of dirty cards
+      // beginning at a word-boundary, extending the dirty window a row at a time
+      if (is_word_aligned(cur_entry)) {
+        CardValue* cur_row = cur_entry - BytesPerWord;
+        while (cur_row >= limit && *((intptr_t*)cur_row) == CardTableRS::dirty_card_row_val()) {
+          *((intptr_t*)cur_row) = CardTableRS::clean_card_row_val();
+          cur_row -= BytesPerWord;
+        }
+        cur_entry = cur_row + BytesPerWord;
+        start_of_non_clean = _ct->addr_for(cur_entry);
+      }
     } else {
       // We hit a "clean" card; process any non-empty
       // "dirty" range accumulated so far.
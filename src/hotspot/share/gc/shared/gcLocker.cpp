@@ -92,6 +92,19 @@ bool GCLocker::is_at_safepoint() {
   return SafepointSynchronize::is_at_safepoint();
 }
 
+// The GCLocker model is deliberately coarse: one global count of
+// threads in JNI critical regions, and any collection that needs the
+// whole heap waits for the count to reach zero.  The finer alternative
+// is per-object (for G1, per-region) pinning — a critical-section entry
+// pins the region holding the array, evacuation skips pinned regions,
+// and unrelated GCs proceed.  Shenandoah already works that way
+// internally.  Expressing it as a shared CollectedHeap::pin_object API
+// means every collector must either honor pins in its evacuation
+// decisions or fall back to this lock, and the JNI entry points in
+// jni.cpp must switch from the critical counter to pin/unpin pairs with
+// identical nesting semantics.  Until then, frequent critical sections
+// plus frequent young GCs will queue allocation failures behind
+// stall_until_clear() below.
 bool GCLocker::check_active_before_gc() {
   assert(SafepointSynchronize::is_at_safepoint(), "only read at safepoint");
   if (is_active() && !_needs_gc) {
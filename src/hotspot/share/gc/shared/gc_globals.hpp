@@ -141,6 +141,11 @@
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
                                                                             \
+  product(bool, LearnGCTaskScalability, false, DIAGNOSTIC,                  \
+          "Learn per-task worker-count scalability and cap workers for "    \
+          "tasks that have stopped scaling. Only applies to tasks that "    \
+          "treat their requested worker count as a hint")                   \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
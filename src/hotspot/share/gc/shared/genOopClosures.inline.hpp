@@ -35,6 +35,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 #if INCLUDE_SERIALGC
 #include "gc/serial/defNewGeneration.inline.hpp"
 #endif
@@ -56,6 +57,8 @@ inline void FastScanClosure<Derived>::do_oop_work(T* p) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
     if (cast_from_oop<HeapWord*>(obj) < _young_gen_end) {
       assert(!_young_gen->to()->is_in_reserved(obj), "Scanning field twice?");
+      // Prefetch ahead of the copy; the source object is likely cold.
+      Prefetch::read(cast_from_oop<void*>(obj), PrefetchScanIntervalInBytes);
       oop new_obj = obj->is_forwarded() ? obj->forwardee()
                                         : _young_gen->copy_to_survivor_space(obj);
       RawAccess<IS_NOT_NULL>::oop_store(p, new_obj);
@@ -1101,6 +1101,18 @@ void OopStorage::BasicParState::update_concurrent_iteration_count(int value) {
   }
 }
 
+// Density-aware claiming (dense blocks first, empty blocks skipped via a
+// summary) has been considered for storages with many sparse blocks and
+// rejected.  Within a block the allocation bitmap already makes unused
+// entries nearly free to pass over, and fully empty blocks do not linger:
+// delete_empty_blocks() removes them from the active array, and the
+// allocation list is ordered so new allocations refill partly-used blocks
+// before cutting new ones, which keeps density up by construction.  A
+// density-ordered visit would also replace the single fetch-and-add below
+// with a permutation that must be rebuilt as occupancy changes.  Note that
+// compacting entries out of sparse blocks is not an option at all: clients
+// hold raw entry addresses (a jobject for a JNI global ref is exactly such
+// a pointer), so an entry can never move during its lifetime.
 bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
   data->_processed += data->_segment_end - data->_segment_start;
   size_t start = Atomic::load_acquire(&_next_block);
@@ -63,6 +63,14 @@ public:
   // precondition: chunk_size must be the same as used to start the task sequence.
   inline Step next(arrayOop from, arrayOop to, int chunk_size) const;
 
+  // Chunk size to use for an array of the given length.  base_chunk_size is
+  // used as-is for moderately sized arrays.  For very large arrays the
+  // stride is scaled up to bound the number of chunks, limiting per-chunk
+  // claiming overhead while still providing many more chunks than workers
+  // for load balancing.  The result is a pure function of the arguments, so
+  // start() and next() callers always agree on the size for a given array.
+  inline int chunk_size(int length, int base_chunk_size) const;
+
   class TestSupport;            // For unit tests
 
 private:
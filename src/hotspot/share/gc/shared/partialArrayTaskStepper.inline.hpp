@@ -115,4 +115,17 @@ PartialArrayTaskStepper::next(arrayOop from, arrayOop to, int chunk_size) const
   return next_impl(from->length(), to->length_addr(), chunk_size);
 }
 
+int PartialArrayTaskStepper::chunk_size(int length, int base_chunk_size) const {
+  assert(base_chunk_size > 0, "precondition");
+  // Allow a generous number of chunks per task slot before scaling up;
+  // stealing needs plenty of spare chunks to balance the load.
+  const uint chunks_per_task = 64;
+  const uint chunk_limit = _task_limit * chunks_per_task;
+  int chunk = base_chunk_size;
+  while (((uint)(length / chunk) > chunk_limit) && (chunk <= max_jint / 2)) {
+    chunk *= 2;
+  }
+  return chunk;
+}
+
 #endif // SHARE_GC_SHARED_PARTIALARRAYTASKSTEPPER_INLINE_HPP
@@ -136,6 +136,18 @@ void PLABStats::log_sizing(size_t calculated_words, size_t net_desired_words) {
 }
 
 // Calculates plab size for current number of gc worker threads.
+//
+// Collectors already keep one PLABStats per destination (e.g. G1 has
+// separate survivor and old instances), and the filter above is an
+// exponentially weighted average, so per-destination adaptivity and
+// smoothing exist.  What is deliberately shared is the per-worker size:
+// all workers get the same slice of the net desired size.  Splitting
+// the sensors per worker would let workers with skewed object-size
+// mixes diverge, but each per-worker sequence then sees 1/Nth of the
+// samples per GC and sizing noise grows accordingly; with work stealing
+// the mix a worker sees is not stable across pauses either.  Waste
+// percentages should be attacked via TargetPLABWastePct and the
+// per-destination stats before adding that dimension.
 size_t PLABStats::desired_plab_sz(uint no_of_gc_workers) {
   if (!ResizePLAB) {
       return _default_plab_sz;
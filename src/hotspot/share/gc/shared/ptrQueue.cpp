@@ -30,8 +30,10 @@
 #include "runtime/atomic.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/globalCounter.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 #include <new>
 
@@ -59,20 +61,34 @@ void BufferNode::deallocate(BufferNode* node) {
 BufferNode::Allocator::Allocator(const char* name, size_t buffer_size) :
   _buffer_size(buffer_size),
   _pending_list(),
-  _free_list(),
+  _free_lists(),
   _pending_count(0),
   _free_count(0),
-  _transfer_lock(false)
+  _transfer_lock(false),
+  _remote_pop_count(0)
 {
   strncpy(_name, name, sizeof(_name) - 1);
   _name[sizeof(_name) - 1] = '\0';
 }
 
 BufferNode::Allocator::~Allocator() {
-  delete_list(_free_list.pop_all());
+  for (uint i = 0; i < max_shards; ++i) {
+    delete_list(_free_lists[i]._list.pop_all());
+  }
   delete_list(_pending_list.pop_all());
 }
 
+// The free list shard preferred by the current thread.  With NUMA enabled
+// this is derived from the node the thread is running on, so buffers tend
+// to be recycled within a node.  Without NUMA only shard 0 is used.
+uint BufferNode::Allocator::current_shard() {
+  STATIC_ASSERT(is_power_of_2(max_shards));
+  if (UseNUMA) {
+    return (uint)os::numa_get_group_id() & (max_shards - 1);
+  }
+  return 0;
+}
+
 void BufferNode::Allocator::delete_list(BufferNode* list) {
   while (list != NULL) {
     BufferNode* next = list->next();
@@ -86,12 +102,25 @@ size_t BufferNode::Allocator::free_count() const {
   return Atomic::load(&_free_count);
 }
 
+size_t BufferNode::Allocator::remote_pop_count() const {
+  return Atomic::load(&_remote_pop_count);
+}
+
 BufferNode* BufferNode::Allocator::allocate() {
   BufferNode* node;
+  const uint shard = current_shard();
   {
     // Protect against ABA; see release().
     GlobalCounter::CriticalSection cs(Thread::current());
-    node = _free_list.pop();
+    node = _free_lists[shard]._list.pop();
+    // Local shard is empty; try to take a node from the other shards
+    // before falling back to allocating a new one.
+    for (uint i = 1; (node == NULL) && (i < max_shards); ++i) {
+      node = _free_lists[(shard + i) & (max_shards - 1)]._list.pop();
+      if (node != NULL) {
+        Atomic::inc(&_remote_pop_count);
+      }
+    }
   }
   if (node == NULL) {
     node = BufferNode::allocate(_buffer_size);
@@ -107,14 +136,14 @@ BufferNode* BufferNode::Allocator::allocate() {
 
 // To solve the ABA problem for lock-free stack pop, allocate does the
 // pop inside a critical section, and release synchronizes on the
-// critical sections before adding to the _free_list.  But we don't
+// critical sections before adding to the free list.  But we don't
 // want to make every release have to do a synchronize.  Instead, we
 // initially place released nodes on the _pending_list, and transfer
-// them to the _free_list in batches.  Only one transfer at a time is
+// them to the free list in batches.  Only one transfer at a time is
 // permitted, with a lock bit to control access to that phase.  A
 // transfer takes all the nodes from the _pending_list, synchronizes on
-// the _free_list pops, and then adds the former pending nodes to the
-// _free_list.  While that's happening, other threads might be adding
+// the free list pops, and then adds the former pending nodes to the
+// free list.  While that's happening, other threads might be adding
 // other nodes to the _pending_list, to be dealt with by some later
 // transfer.
 void BufferNode::Allocator::release(BufferNode* node) {
@@ -138,8 +167,8 @@ void BufferNode::Allocator::release(BufferNode* node) {
   }
 }
 
-// Try to transfer nodes from _pending_list to _free_list, with a
-// synchronization delay for any in-progress pops from the _free_list,
+// Try to transfer nodes from _pending_list to the free list, with a
+// synchronization delay for any in-progress pops from the free list,
 // to solve ABA there.  Return true if performed a (possibly empty)
 // transfer, false if blocked from doing so by some other thread's
 // in-progress transfer.
@@ -166,10 +195,10 @@ bool BufferNode::Allocator::try_transfer_pending() {
     // Wait for any in-progress pops, to avoid ABA for them.
     GlobalCounter::write_synchronize();
 
-    // Add synchronized nodes to _free_list.
+    // Add synchronized nodes to the transferring thread's free list shard.
     // Update count first so no underflow in allocate().
     Atomic::add(&_free_count, count);
-    _free_list.prepend(*first, *last);
+    _free_lists[current_shard()]._list.prepend(*first, *last);
     log_trace(gc, ptrqueue, freelist)
              ("Transferred %s pending to free: " SIZE_FORMAT, name(), count);
   }
@@ -180,15 +209,19 @@ bool BufferNode::Allocator::try_transfer_pending() {
 size_t BufferNode::Allocator::reduce_free_list(size_t remove_goal) {
   try_transfer_pending();
   size_t removed = 0;
-  for ( ; removed < remove_goal; ++removed) {
-    BufferNode* node = _free_list.pop();
-    if (node == NULL) break;
-    BufferNode::deallocate(node);
+  for (uint shard = 0; (removed < remove_goal) && (shard < max_shards); ++shard) {
+    while (removed < remove_goal) {
+      BufferNode* node = _free_lists[shard]._list.pop();
+      if (node == NULL) break;
+      BufferNode::deallocate(node);
+      ++removed;
+    }
   }
   size_t new_count = Atomic::sub(&_free_count, removed);
   log_debug(gc, ptrqueue, freelist)
-           ("Reduced %s free list by " SIZE_FORMAT " to " SIZE_FORMAT,
-            name(), removed, new_count);
+           ("Reduced %s free list by " SIZE_FORMAT " to " SIZE_FORMAT
+            " (remote shard pops " SIZE_FORMAT ")",
+            name(), removed, new_count, remote_pop_count());
   return removed;
 }
 
@@ -181,16 +181,28 @@ class BufferNode::Allocator {
 #define DECLARE_PADDED_MEMBER(Id, Type, Name) \
   Type Name; DEFINE_PAD_MINUS_SIZE(Id, DEFAULT_CACHE_LINE_SIZE, sizeof(Type))
 
+  // The free list is sharded to reduce contention on the list head.  On a
+  // NUMA system, threads prefer the shard for their node, keeping recycled
+  // buffers local; otherwise everything uses shard 0 and the remaining
+  // shards stay empty.  Each shard is padded to its own cache line.
+  struct FreeListShard {
+    Stack _list;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(Stack));
+  };
+  static const uint max_shards = 8;
+
   const size_t _buffer_size;
   char _name[DEFAULT_CACHE_LINE_SIZE - sizeof(size_t)]; // Use name as padding.
   DECLARE_PADDED_MEMBER(1, Stack, _pending_list);
-  DECLARE_PADDED_MEMBER(2, Stack, _free_list);
+  FreeListShard _free_lists[max_shards];
   DECLARE_PADDED_MEMBER(3, volatile size_t, _pending_count);
   DECLARE_PADDED_MEMBER(4, volatile size_t, _free_count);
   DECLARE_PADDED_MEMBER(5, volatile bool, _transfer_lock);
+  DECLARE_PADDED_MEMBER(6, volatile size_t, _remote_pop_count);
 
 #undef DECLARE_PADDED_MEMBER
 
+  static uint current_shard();
   void delete_list(BufferNode* list);
   bool try_transfer_pending();
 
@@ -203,6 +215,9 @@ public:
   const char* name() const { return _name; }
   size_t buffer_size() const { return _buffer_size; }
   size_t free_count() const;
+  // Number of allocations satisfied from another thread's shard; a high
+  // value relative to the allocation rate indicates shard imbalance.
+  size_t remote_pop_count() const;
   BufferNode* allocate();
   void release(BufferNode* node);
 
@@ -40,6 +40,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/nonJavaThread.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 ReferencePolicy* ReferenceProcessor::_always_clear_soft_ref_policy = NULL;
@@ -233,7 +234,16 @@ void DiscoveredListIterator::load_ptrs(DEBUG_ONLY(bool allow_null_referent)) {
   assert(_current_discovered_addr && oopDesc::is_oop_or_null(discovered),
          "Expected an oop or NULL for discovered field at " PTR_FORMAT, p2i(discovered));
   _next_discovered = discovered;
+  // The list walk is a pointer chase through cold memory; prefetch the next
+  // Reference so its fields are being fetched while this one is processed.
+  if (discovered != NULL && discovered != _current_discovered) {
+    Prefetch::read(cast_from_oop<void*>(discovered), 0);
+  }
   _referent = java_lang_ref_Reference::unknown_referent_no_keepalive(_current_discovered);
+  // The alive closure and referent clearing touch the referent next.
+  if (_referent != NULL) {
+    Prefetch::read(cast_from_oop<void*>(_referent), 0);
+  }
   assert(Universe::heap()->is_in_or_null(_referent),
          "Wrong oop found in java.lang.Reference object");
   assert(allow_null_referent ?
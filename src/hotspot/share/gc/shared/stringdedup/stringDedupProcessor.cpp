@@ -43,6 +43,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/quickSort.hpp"
 
 StringDedup::Processor::Processor() : ConcurrentGCThread() {
   set_name("StringDedupProcessor");
@@ -132,6 +133,20 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
+  // Requests are gathered into batches and processed in bucket order, so
+  // the table probes walk the buckets sequentially instead of jumping
+  // around the table.  Only the storage slot and the content-based hash
+  // code are retained across yields; the string is reloaded when probing.
+  static const size_t batch_size = 64;
+
+  struct BatchedRequest {
+    oop* _ref;
+    uint _hash_code;
+  };
+
+  BatchedRequest _batch[batch_size];
+  size_t _batch_count;
+
   void release_ref(oop* ref) {
     assert(_release_index < ARRAY_SIZE(_bulk_release), "invariant");
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(ref, nullptr);
@@ -142,15 +157,52 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
     }
   }
 
+  static int compare_by_bucket(BatchedRequest a, BatchedRequest b) {
+    size_t index_a = Table::hash_to_index(a._hash_code);
+    size_t index_b = Table::hash_to_index(b._hash_code);
+    if (index_a < index_b) return -1;
+    if (index_a > index_b) return 1;
+    return 0;
+  }
+
+  void process_batch() {
+    QuickSort::sort(_batch, (int)_batch_count, compare_by_bucket, false);
+    for (size_t i = 0; i < _batch_count; ++i) {
+      if (!_processor->yield_or_continue(_joiner, Stat::Phase::process)) {
+        break;                  // Terminating; leave remaining requests.
+      }
+      oop* ref = _batch[i]._ref;
+      // Reload; the string may have died or moved since the hash code was
+      // computed.  The hash code only depends on the array contents, so it
+      // is still valid.
+      oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
+      release_ref(ref);
+      if (java_string == nullptr) {
+        _cur_stat.inc_skipped_dead();
+      } else {
+        Table::deduplicate(java_string, _batch[i]._hash_code);
+        if (Table::is_grow_needed()) {
+          _cur_stat.report_process_pause();
+          _processor->cleanup_table(_joiner, true /* grow_only */, false /* force */);
+          _cur_stat.report_process_resume();
+        }
+      }
+    }
+    _batch_count = 0;
+  }
+
 public:
   ProcessRequest(OopStorage* storage, SuspendibleThreadSetJoiner* joiner) :
     _storage(storage),
     _joiner(joiner),
     _release_index(0),
-    _bulk_release()
+    _bulk_release(),
+    _batch(),
+    _batch_count(0)
   {}
 
   ~ProcessRequest() {
+    process_batch();
     _storage->release(_bulk_release, _release_index);
   }
 
@@ -159,21 +211,21 @@ public:
   virtual void do_oop(oop* ref) {
     if (_processor->yield_or_continue(_joiner, Stat::Phase::process)) {
       oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
-      release_ref(ref);
-      // Dedup java_string, after checking for various reasons to skip it.
+      // Batch java_string, after checking for various reasons to skip it.
       if (java_string == nullptr) {
         // String became unreachable before we got a chance to process it.
+        release_ref(ref);
         _cur_stat.inc_skipped_dead();
       } else if (java_lang_String::value(java_string) == nullptr) {
         // Request during String construction, before its value array has
         // been initialized.
+        release_ref(ref);
         _cur_stat.inc_skipped_incomplete();
       } else {
-        Table::deduplicate(java_string);
-        if (Table::is_grow_needed()) {
-          _cur_stat.report_process_pause();
-          _processor->cleanup_table(_joiner, true /* grow_only */, false /* force */);
-          _cur_stat.report_process_resume();
+        _batch[_batch_count]._ref = ref;
+        _batch[_batch_count]._hash_code = Table::compute_hash_of(java_string);
+        if (++_batch_count == batch_size) {
+          process_batch();
         }
       }
     }
@@ -632,7 +632,16 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
+uint StringDedup::Table::compute_hash_of(oop java_string) {
+  assert(java_lang_String::is_instance(java_string), "precondition");
+  return compute_hash(java_lang_String::value(java_string));
+}
+
 void StringDedup::Table::deduplicate(oop java_string) {
+  deduplicate(java_string, compute_hash_of(java_string));
+}
+
+void StringDedup::Table::deduplicate(oop java_string, uint hash_code) {
   assert(java_lang_String::is_instance(java_string), "precondition");
   _cur_stat.inc_inspected();
   if ((StringTable::shared_entry_count() > 0) &&
@@ -640,7 +649,6 @@ void StringDedup::Table::deduplicate(oop java_string) {
     return;                     // Done if deduplicated against shared StringTable.
   }
   typeArrayOop value = java_lang_String::value(java_string);
-  uint hash_code = compute_hash(value);
   TableValue tv = find(value, hash_code);
   if (tv.is_empty()) {
     // Not in table.  Create a new table entry.
@@ -91,7 +91,6 @@ private:
   static volatile DeadState _dead_state;
 
   static uint compute_hash(typeArrayOop obj);
-  static size_t hash_to_index(uint hash_code);
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
   static void install(typeArrayOop obj, uint hash_code);
@@ -117,6 +116,19 @@ public:
   // Otherwise, add the string's data array to the table.
   static void deduplicate(oop java_string);
 
+  // As above, with the hash code of the string's data array precomputed by
+  // compute_hash_of.  Lets callers batch requests and order the table
+  // probes by bucket.
+  static void deduplicate(oop java_string, uint hash_code);
+
+  // Compute the hash code of java_string's data array.  The hash code only
+  // depends on the array contents, so it stays valid across safepoints.
+  // precondition: java_string's value array is non-null.
+  static uint compute_hash_of(oop java_string);
+
+  // The index of the bucket hash_code maps to in the current table.
+  static size_t hash_to_index(uint hash_code);
+
   // Returns true if table needs to grow.
   static bool is_grow_needed();
 
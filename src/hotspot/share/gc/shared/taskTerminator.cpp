@@ -28,6 +28,7 @@
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.hpp"
@@ -142,6 +143,27 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
 
   Thread* the_thread = Thread::current();
 
+  // With many workers the check-in through the mutex below becomes a point
+  // of contention, and work frequently reappears while workers queue up on
+  // it. Spin briefly outside the mutex first: a worker that finds tasks or
+  // is asked to exit here leaves without having touched terminator state.
+  // Do not linger once everybody else has offered termination, since the
+  // last check-in is what terminates the protocol.
+  {
+    const uint pre_spin_steps = 4;
+    DelayContext delay_context;
+    for (uint i = 0; i < pre_spin_steps; i++) {
+      if (Atomic::load(&_offered_termination) + 1 >= _n_threads) {
+        break;
+      }
+      delay_context.do_step();
+      size_t tasks = tasks_in_queue_set();
+      if (exit_termination(tasks, terminator)) {
+        return false;
+      }
+    }
+  }
+
   MonitorLocker x(&_blocker, Mutex::_no_safepoint_check_flag);
   _offered_termination++;
 
@@ -31,6 +31,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
 
@@ -327,6 +328,15 @@ GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
       TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal());
       return true;
     }
+    // Back off before sampling new victims. The first round of attempts
+    // retries immediately to keep steal latency low when queues only
+    // briefly appear empty; later rounds pause increasingly longer to
+    // reduce coherence traffic on the queue indices while work is scarce.
+    // Parking is left to the caller, which offers termination through
+    // TaskTerminator once stealing fails altogether.
+    for (uint j = _n; j <= i; j++) {
+      SpinPause();
+    }
   }
   return false;
 }
@@ -27,6 +27,8 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -56,7 +58,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _allocation_fraction(TLABAllocationWeight),
+  _allocation_rate_avg(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -85,6 +88,13 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
+  // Track this thread's own allocation rate, in bytes per GC epoch. Unlike
+  // the eden fraction below, this is sampled unconditionally, so that the
+  // average decays for threads that have gone idle.
+  _allocation_rate_avg.sample((float)allocated_since_last_gc);
+
+  send_refill_statistics_event();
+
   if (_number_of_refills > 0) {
     // Update allocation history if a reasonable amount of eden was allocated.
     bool update_allocation_history = used > 0.5 * capacity;
@@ -116,6 +126,20 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   reset_statistics();
 }
 
+void ThreadLocalAllocBuffer::send_refill_statistics_event() {
+  EventTLABRefillStatistics event;
+  if (event.should_commit()) {
+    // The event is committed by the VM thread at a safepoint; identify the
+    // thread owning the buffer explicitly.
+    event.set_thread(JFR_THREAD_ID(thread()));
+    event.set_refills(_number_of_refills);
+    event.set_slowAllocations(_slow_allocations);
+    event.set_allocated(_allocated_size * HeapWordSize);
+    event.set_desiredTLABSize(desired_size() * HeapWordSize);
+    event.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::insert_filler() {
   assert(end() != NULL, "Must not be retired");
   if (top() < hard_end()) {
@@ -157,7 +181,11 @@ void ThreadLocalAllocBuffer::resize() {
   assert(ResizeTLAB, "Should not call this otherwise");
   size_t alloc = (size_t)(_allocation_fraction.average() *
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
-  size_t new_size = alloc / _target_refills;
+  // Pools mixing hot and near-idle threads leave the eden fraction of the
+  // hot threads small, starving them down to minimal TLABs. Also size from
+  // the thread's own allocation rate and use whichever expects more.
+  size_t rate_alloc = (size_t)_allocation_rate_avg.average() / HeapWordSize;
+  size_t new_size = MAX2(alloc, rate_alloc) / _target_refills;
 
   new_size = clamp(new_size, min_size(), max_size());
 
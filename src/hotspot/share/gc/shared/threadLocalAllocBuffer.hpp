@@ -69,6 +69,7 @@ private:
   size_t    _allocated_size;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  AdaptiveWeightedAverage _allocation_rate_avg;  // bytes allocated by this thread between GCs
 
   void reset_statistics();
 
@@ -98,6 +99,8 @@ private:
 
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
+  void send_refill_statistics_event();
+
   void print_stats(const char* tag);
 
   Thread* thread();
@@ -89,3 +89,24 @@ void WorkerDataArray<size_t>::WDAPrinter::details(const WorkerDataArray<size_t>*
   }
   out->cr();
 }
+
+template <>
+void WorkerDataArray<double>::WDAPrinter::folded(const WorkerDataArray<double>* phase, outputStream* out, const char* prefix) {
+  for (uint i = 0; i < phase->_length; ++i) {
+    double value = phase->get(i);
+    if (value != phase->uninitialized()) {
+      out->print_cr("%s;%s;worker-%u " JULONG_FORMAT,
+                    prefix, phase->title(), i, (julong)(value * MICROUNITS));
+    }
+  }
+}
+
+template <>
+void WorkerDataArray<size_t>::WDAPrinter::folded(const WorkerDataArray<size_t>* phase, outputStream* out, const char* prefix) {
+  for (uint i = 0; i < phase->_length; ++i) {
+    size_t value = phase->get(i);
+    if (value != phase->uninitialized()) {
+      out->print_cr("%s;%s;worker-%u " SIZE_FORMAT, prefix, phase->title(), i, value);
+    }
+  }
+}
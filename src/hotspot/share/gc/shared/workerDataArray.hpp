@@ -98,11 +98,19 @@ private:
 
     static void details(const WorkerDataArray<double>* phase, outputStream* out);
     static void details(const WorkerDataArray<size_t>* phase, outputStream* out);
+
+    static void folded(const WorkerDataArray<double>* phase, outputStream* out, const char* prefix);
+    static void folded(const WorkerDataArray<size_t>* phase, outputStream* out, const char* prefix);
   };
 
  public:
   void print_summary_on(outputStream* out, bool print_sum = true) const;
   void print_details_on(outputStream* out) const;
+
+  // Print one "prefix;title;worker-N value" line per initialized slot, the
+  // folded-stack format consumed by flamegraph tooling.  Time values are
+  // printed in microseconds, since the format requires integral values.
+  void print_folded_on(outputStream* out, const char* prefix) const;
 };
 
 #endif // SHARE_GC_SHARED_WORKERDATAARRAY_HPP
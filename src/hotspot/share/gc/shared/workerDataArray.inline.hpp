@@ -202,6 +202,11 @@ void WorkerDataArray<T>::print_details_on(outputStream* out) const {
   WDAPrinter::details(this, out);
 }
 
+template <class T>
+void WorkerDataArray<T>::print_folded_on(outputStream* out, const char* prefix) const {
+  WDAPrinter::folded(this, out, prefix);
+}
+
 template <typename T>
 void WorkerDataArray<T>::reset() {
   set_all(uninitialized());
@@ -30,6 +30,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/os.hpp"
+#include "utilities/ticks.hpp"
 
 WorkerTaskDispatcher::WorkerTaskDispatcher() :
     _task(NULL),
@@ -82,7 +83,9 @@ WorkerThreads::WorkerThreads(const char* name, uint max_workers) :
     _max_workers(max_workers),
     _created_workers(0),
     _active_workers(0),
-    _dispatcher() {}
+    _dispatcher(),
+    _scalability(),
+    _scalability_count(0) {}
 
 void WorkerThreads::initialize_workers() {
   const uint initial_active_workers = UseDynamicNumberOfGCThreads ? 1 : _max_workers;
@@ -141,9 +144,73 @@ void WorkerThreads::run_task(WorkerTask* task) {
   _dispatcher.coordinator_distribute_task(task, _active_workers);
 }
 
+WorkerThreads::TaskScalability* WorkerThreads::scalability_record(const char* name) {
+  for (uint i = 0; i < _scalability_count; i++) {
+    if (strcmp(_scalability[i]._name, name) == 0) {
+      return &_scalability[i];
+    }
+  }
+  if (_scalability_count == max_scalability_records) {
+    return NULL;
+  }
+  TaskScalability* record = &_scalability[_scalability_count++];
+  record->_name = name;
+  return record;
+}
+
+uint WorkerThreads::learned_workers(WorkerTask* task, uint num_workers) {
+  // Only tasks that declare their worker count a hint may be capped;
+  // for tasks that partition work by worker id, num_workers is a
+  // correctness requirement and must be passed through untouched.
+  if (!LearnGCTaskScalability || !task->workers_are_hint()) {
+    return num_workers;
+  }
+  TaskScalability* record = scalability_record(task->name());
+  if (record != NULL && record->_ceiling != 0 && record->_ceiling < num_workers) {
+    log_trace(gc, task)("%s: capping %s at %u workers (%u requested)",
+                        _name, task->name(), record->_ceiling, num_workers);
+    return record->_ceiling;
+  }
+  return num_workers;
+}
+
+void WorkerThreads::record_scalability(WorkerTask* task, uint num_workers, double seconds) {
+  if (!LearnGCTaskScalability || !task->workers_are_hint()) {
+    return;
+  }
+  // Normalize by the work processed: the raw duration of a GC task says
+  // nothing about scaling when the work volume varies between runs.
+  const size_t units = task->processed_work_units();
+  TaskScalability* record = scalability_record(task->name());
+  if (record == NULL || units == 0 || seconds <= 0.0) {
+    return;
+  }
+  const double rate = (double)units / seconds;
+  if (record->_best_rate == 0.0) {
+    record->_best_workers = num_workers;
+    record->_best_rate = rate;
+  } else if (num_workers == record->_best_workers) {
+    // Re-sample the reference point, smoothed since the task's work-unit
+    // estimates are approximate.
+    record->_best_rate = record->_best_rate * 0.7 + rate * 0.3;
+  } else if (rate > record->_best_rate * 1.05) {
+    // Clear improvement; adopt this worker count and lift any cap.
+    record->_best_workers = num_workers;
+    record->_best_rate = rate;
+    record->_ceiling = 0;
+  } else if (num_workers > record->_best_workers) {
+    // More workers without improvement; the task has stopped scaling.
+    record->_ceiling = record->_best_workers;
+    log_debug(gc, task)("%s: %s does not scale past %u workers",
+                        _name, task->name(), record->_best_workers);
+  }
+}
+
 void WorkerThreads::run_task(WorkerTask* task, uint num_workers) {
-  WithActiveWorkers with_active_workers(this, num_workers);
+  WithActiveWorkers with_active_workers(this, learned_workers(task, num_workers));
+  const Ticks start = Ticks::now();
   run_task(task);
+  record_scalability(task, active_workers(), (Ticks::now() - start).seconds());
 }
 
 WorkerThread::WorkerThread(const char* name_prefix, uint id, WorkerTaskDispatcher* dispatcher) :
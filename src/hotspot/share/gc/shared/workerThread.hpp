@@ -51,6 +51,20 @@ private:
   const uint gc_id() const { return _gc_id; }
 
   virtual void work(uint worker_id) = 0;
+
+  // A task may declare the worker count passed to run_task(task, num_workers)
+  // a performance hint rather than a requirement, making it eligible for
+  // scalability learning (see WorkerThreads::learned_workers).  Tasks that
+  // partition their work by worker id up to the requested count - for
+  // example reference processing, where each worker drains its own
+  // discovered list - must not override this: running them with fewer
+  // workers than requested would leave work unprocessed.
+  virtual bool workers_are_hint() const { return false; }
+
+  // The amount of work processed by the last run, in task-defined units,
+  // used to normalize measured completion rates across runs of different
+  // sizes.  Returning 0 (unknown) disables learning for that run.
+  virtual size_t processed_work_units() const { return 0; }
 };
 
 // WorkerThreads dispatcher implemented with semaphores
@@ -84,12 +98,34 @@ public:
 // A set of worker threads to execute tasks
 class WorkerThreads : public CHeapObj<mtInternal> {
 private:
+  // Observed scalability of a task that declares its worker count a hint
+  // (see WorkerTask::workers_are_hint).  Tracks the best processing rate
+  // seen for the task and the worker count that achieved it.  When running
+  // with more workers fails to beat that rate, the worker count is capped
+  // at the best known count for later runs; a later improvement lifts the
+  // cap again.  Only engaged with LearnGCTaskScalability.  Only accessed
+  // by the coordinator, which runs one task at a time.
+  struct TaskScalability {
+    const char* _name;    // Task name; assumed to be a stable literal.
+    uint _best_workers;   // Worker count with the best observed rate.
+    double _best_rate;    // Best observed rate, in work units per second.
+    uint _ceiling;        // Learned cap on workers, 0 if not capped.
+  };
+
+  static const uint max_scalability_records = 8;
+
   const char* const    _name;
   WorkerThread**       _workers;
   const uint           _max_workers;
   uint                 _created_workers;
   uint                 _active_workers;
   WorkerTaskDispatcher _dispatcher;
+  TaskScalability      _scalability[max_scalability_records];
+  uint                 _scalability_count;
+
+  TaskScalability* scalability_record(const char* name);
+  uint learned_workers(WorkerTask* task, uint num_workers);
+  void record_scalability(WorkerTask* task, uint num_workers, double seconds);
 
 protected:
   virtual WorkerThread* create_worker(uint id);
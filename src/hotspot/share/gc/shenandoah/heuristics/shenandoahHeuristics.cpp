@@ -39,6 +39,12 @@ int ShenandoahHeuristics::compare_by_garbage(RegionData a, RegionData b) {
     return -1;
   else if (a._garbage < b._garbage)
     return 1;
+  // Tie-break by age: young regions are more likely to keep dying, so prefer
+  // taking them before repeatedly copying long-surviving regions around.
+  else if (a._region->age() < b._region->age())
+    return -1;
+  else if (a._region->age() > b._region->age())
+    return 1;
   else return 0;
 }
 
@@ -110,6 +116,9 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         immediate_garbage += garbage;
         region->make_trash_immediate();
       } else {
+        // Survived another marking cycle with live data.
+        region->increment_age();
+
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
         candidates[cand_idx]._garbage = garbage;
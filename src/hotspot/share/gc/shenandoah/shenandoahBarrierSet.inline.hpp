@@ -66,6 +66,7 @@ inline oop ShenandoahBarrierSet::load_reference_barrier_mutator(oop obj, T* load
     Thread* const t = Thread::current();
     ShenandoahEvacOOMScope scope(t);
     fwd = _heap->evacuate_object(obj, t);
+    _heap->evacuate_object_cluster(obj, t);
   }
 
   if (load_addr != NULL && fwd != obj) {
@@ -545,6 +545,11 @@ void ShenandoahConcurrentGC::op_init_mark() {
     ShenandoahCodeRoots::arm_nmethods();
   }
 
+  // Flipping the watermark epoch is all the stack work this pause does:
+  // no frames are walked here.  Each thread's stack is processed lazily
+  // by its ShenandoahStackWatermark when the thread resumes (or by GC
+  // workers for parked threads during concurrent root marking), so the
+  // init-mark pause cost no longer scales with thread count.
   ShenandoahStackWatermark::change_epoch_id();
   if (ShenandoahPacing) {
     heap->pacer()->setup_for_mark();
@@ -622,6 +622,10 @@ public:
   // by this thread, or by some other thread.
   inline oop evacuate_object(oop src, Thread* thread);
 
+  // Evacuates a few marked objects following src in its region, amortizing
+  // the slow path overhead over a cluster of likely-related objects.
+  inline void evacuate_object_cluster(oop src, Thread* thread);
+
   // Call before/after evacuation.
   inline void enter_evacuation(Thread* t);
   inline void leave_evacuation(Thread* t);
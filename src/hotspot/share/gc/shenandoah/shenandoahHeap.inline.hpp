@@ -362,6 +362,41 @@ inline oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
   }
 }
 
+inline void ShenandoahHeap::evacuate_object_cluster(oop p, Thread* thread) {
+  if (ShenandoahEvacClusterSize <= 1) {
+    return;
+  }
+
+  if (ShenandoahThreadLocalData::is_oom_during_evac(thread)) {
+    // No more evacuations allowed from this thread.
+    return;
+  }
+
+  // Walk the marked objects following p, up to the cluster size. Objects
+  // allocated together are likely referenced together, so evacuating the
+  // whole cluster in one slow path call amortizes its overhead and keeps
+  // the copies adjacent. Racing evacuations are resolved by evacuate_object.
+  ShenandoahHeapRegion* const r = heap_region_containing(p);
+  ShenandoahMarkingContext* const ctx = marking_context();
+  HeapWord* const limit = ctx->top_at_mark_start(r);
+  HeapWord* cur = cast_from_oop<HeapWord*>(p) + p->size();
+
+  for (uintx n = 1; n < ShenandoahEvacClusterSize && cur < limit; n++) {
+    cur = ctx->get_next_marked_addr(cur, limit);
+    if (cur >= limit) {
+      break;
+    }
+    oop obj = cast_to_oop(cur);
+    cur += obj->size();
+    if (!ShenandoahForwarding::is_forwarded(obj)) {
+      evacuate_object(obj, thread);
+      if (ShenandoahThreadLocalData::is_oom_during_evac(thread)) {
+        return;
+      }
+    }
+  }
+}
+
 inline bool ShenandoahHeap::requires_marking(const void* entry) const {
   oop obj = cast_to_oop(entry);
   return !_marking_context->is_marked_strong(obj);
@@ -62,6 +62,7 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
   _state(committed ? _empty_committed : _empty_uncommitted),
+  _age(0),
   _top(start),
   _tlab_allocs(0),
   _gclab_allocs(0),
@@ -424,6 +425,7 @@ ShenandoahHeapRegion* ShenandoahHeapRegion::humongous_start_region() const {
 void ShenandoahHeapRegion::recycle() {
   set_top(bottom());
   clear_live_data();
+  reset_age();
 
   reset_alloc_metadata();
 
@@ -234,6 +234,7 @@ private:
 
   // Seldom updated fields
   RegionState _state;
+  uint _age;
 
   // Frequently updated fields
   HeapWord* _top;
@@ -371,6 +372,12 @@ public:
   HeapWord* new_top() const     { return _new_top; }
   void set_new_top(HeapWord* v) { _new_top = v;    }
 
+  // Number of completed marking cycles the region survived with live data.
+  // Heuristics use this to prefer young regions on otherwise equal candidates.
+  uint age() const              { return _age;     }
+  void increment_age()          { _age++;          }
+  void reset_age()              { _age = 0;        }
+
   HeapWord* bottom() const      { return _bottom;  }
   HeapWord* end() const         { return _end;     }
 
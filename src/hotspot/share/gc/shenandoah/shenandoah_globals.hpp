@@ -89,6 +89,14 @@
           "collector accepts. In percents of heap region size.")            \
           range(0,100)                                                      \
                                                                             \
+  product(uintx, ShenandoahEvacClusterSize, 1, EXPERIMENTAL,                \
+          "How many neighboring objects a mutator evacuates in a single "   \
+          "load reference barrier slow path call. Evacuating a cluster "    \
+          "amortizes the slow path overhead and keeps objects allocated "   \
+          "together adjacent after evacuation. The default of 1 "           \
+          "evacuates only the accessed object.")                            \
+          range(1,64)                                                       \
+                                                                            \
   product(uintx, ShenandoahInitFreeThreshold, 70, EXPERIMENTAL,             \
           "How much heap should be free before some heuristics trigger the "\
           "initial (learning) cycles. Affects cycle frequency on startup "  \
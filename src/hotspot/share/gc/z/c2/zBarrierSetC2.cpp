@@ -376,6 +376,19 @@ static uint block_index(const Block* block, const Node* node) {
   return 0;
 }
 
+// This elides a barrier when a dominating access on the same oop has
+// already taken it, with safepoints as the kill points.  The stronger
+// loop-level idea — test once per strip-mined strip whether a whole
+// address range is clean and run a barrier-free inner loop — is not
+// expressible with this elision: a load barrier's guarantee is per
+// reference value, not per address range, so a "strip pre-check" would
+// have to prove that every oop loaded during the strip is already
+// remapped/marked, which only holds for ranges the GC has published as
+// such (e.g. an array whose elements were healed by an earlier pass).
+// That requires a GC-side range predicate and a loop-opts transform
+// that versions the inner loop on it, with the safepoint at the strip
+// boundary re-running the predicate — a joint loopnode/barrier project
+// rather than a change to this analysis.
 void ZBarrierSetC2::analyze_dominating_barriers() const {
   ResourceMark rm;
   Compile* const C = Compile::current();
@@ -65,6 +65,7 @@ public:
   uint8_t type() const;
   uintptr_t start() const;
   size_t size() const;
+  size_t live_bytes() const;
   size_t object_alignment_shift() const;
   void object_iterate(ObjectClosure *cl);
 
@@ -75,6 +75,10 @@ inline size_t ZForwarding::size() const {
   return _virtual.size();
 }
 
+inline size_t ZForwarding::live_bytes() const {
+  return _page->live_bytes();
+}
+
 inline size_t ZForwarding::object_alignment_shift() const {
   return _object_alignment_shift;
 }
@@ -118,6 +122,15 @@ inline ZForwardingEntry ZForwarding::find(uintptr_t from_index, ZForwardingCurso
   // Reading entries in the table races with the atomic CAS done for
   // insertion into the table. This is safe because each entry is at
   // most updated once (from zero to something else).
+  //
+  // On repeated probes: remapping is driven by self-healing load
+  // barriers, which write the remapped address back into the referring
+  // field, so each *field* probes at most once — the heap itself is the
+  // memo, and a per-thread (from_index -> to) cache would only dedup
+  // distinct fields hitting the same target within one thread's window.
+  // There is likewise no natural batch site to sort and cluster
+  // pointers by target page: barriers surface one reference at a time,
+  // not as scan chunks.
   ZForwardingEntry entry = first(from_index, cursor);
   while (entry.populated()) {
     if (entry.from_index() == from_index) {
@@ -402,8 +402,11 @@ bool ZMark::try_steal_global(ZMarkContext* context) {
        victim_stripe = _stripes.stripe_next(victim_stripe)) {
     ZMarkStack* const stack = victim_stripe->steal_stack();
     if (stack != NULL) {
-      // Success, install the stolen stack
-      stacks->install(&_stripes, stripe, stack);
+      // Success. Migrate to the victim stripe instead of dragging single
+      // stacks over to our own stripe, so that an overloaded stripe gets
+      // drained by all idle workers and not just its owner.
+      context->set_stripe(victim_stripe);
+      stacks->install(&_stripes, victim_stripe, stack);
       return true;
     }
   }
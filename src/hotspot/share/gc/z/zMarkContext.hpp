@@ -34,7 +34,7 @@ class ZMarkThreadLocalStacks;
 class ZMarkContext : public StackObj {
 private:
   ZMarkCache                    _cache;
-  ZMarkStripe* const            _stripe;
+  ZMarkStripe*                  _stripe;
   ZMarkThreadLocalStacks* const _stacks;
   StringDedup::Requests         _string_dedup_requests;
 
@@ -45,6 +45,7 @@ public:
 
   ZMarkCache* cache();
   ZMarkStripe* stripe();
+  void set_stripe(ZMarkStripe* stripe);
   ZMarkThreadLocalStacks* stacks();
   StringDedup::Requests* string_dedup_requests();
 };
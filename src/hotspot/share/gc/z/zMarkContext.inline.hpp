@@ -42,6 +42,10 @@ inline ZMarkStripe* ZMarkContext::stripe() {
   return _stripe;
 }
 
+inline void ZMarkContext::set_stripe(ZMarkStripe* stripe) {
+  _stripe = stripe;
+}
+
 inline ZMarkThreadLocalStacks* ZMarkContext::stacks() {
   return _stacks;
 }
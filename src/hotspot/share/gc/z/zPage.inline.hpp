@@ -153,6 +153,17 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < ZGlobalSeqNum;
 }
 
+inline uint32_t ZPage::age() const {
+  // Number of GC cycles started since the page was allocated (reset).
+  return ZGlobalSeqNum - _seqnum;
+}
+
+inline bool ZPage::is_young() const {
+  // A page is considered young if it was allocated during or right
+  // before the current GC cycle.
+  return age() <= 1;
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
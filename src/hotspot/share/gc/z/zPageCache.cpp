@@ -92,10 +92,31 @@ ZPage* ZPageCache::alloc_small_page() {
 }
 
 ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
-  if (page != NULL) {
+  const uint32_t numa_id = ZNUMA::id();
+  const uint32_t numa_count = ZNUMA::count();
+
+  // Try NUMA local page cache
+  ZPage* const l1_page = _medium.get(numa_id).remove_first();
+  if (l1_page != NULL) {
     ZStatInc(ZCounterPageCacheHitL1);
-    return page;
+    return l1_page;
+  }
+
+  // Try NUMA remote page cache(s)
+  uint32_t remote_numa_id = numa_id + 1;
+  const uint32_t remote_numa_count = numa_count - 1;
+  for (uint32_t i = 0; i < remote_numa_count; i++) {
+    if (remote_numa_id == numa_count) {
+      remote_numa_id = 0;
+    }
+
+    ZPage* const l2_page = _medium.get(remote_numa_id).remove_first();
+    if (l2_page != NULL) {
+      ZStatInc(ZCounterPageCacheHitL2);
+      return l2_page;
+    }
+
+    remote_numa_id++;
   }
 
   return NULL;
@@ -118,7 +139,19 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
 
 ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
   if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+    // Try NUMA local list first, then the remote ones
+    const uint32_t numa_count = ZNUMA::count();
+    uint32_t numa_id = ZNUMA::id();
+    for (uint32_t i = 0; i < numa_count; i++) {
+      ZPage* const page = _medium.get(numa_id).remove_first();
+      if (page != NULL) {
+        return page;
+      }
+
+      if (++numa_id == numa_count) {
+        numa_id = 0;
+      }
+    }
   }
 
   return NULL;
@@ -192,7 +225,7 @@ void ZPageCache::free_page(ZPage* page) {
   if (type == ZPageTypeSmall) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageTypeMedium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -240,7 +273,7 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
 void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   // Prefer flushing large, then medium and last small pages
   flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_medium, to);
   flush_per_numa_lists(cl, &_small, to);
 
   if (cl->_flushed > cl->_requested) {
@@ -343,9 +376,12 @@ void ZPageCache::pages_do(ZPageClosure* cl) const {
   }
 
   // Medium
-  ZListIterator<ZPage> iter_medium(&_medium);
-  for (ZPage* page; iter_medium.next(&page);) {
-    cl->do_page(page);
+  ZPerNUMAConstIterator<ZList<ZPage> > iter_numa_medium(&_medium);
+  for (const ZList<ZPage>* list; iter_numa_medium.next(&list);) {
+    ZListIterator<ZPage> iter_medium(list);
+    for (ZPage* page; iter_medium.next(&page);) {
+      cl->do_page(page);
+    }
   }
 
   // Large
@@ -33,7 +33,7 @@ class ZPageCacheFlushClosure;
 class ZPageCache {
 private:
   ZPerNUMA<ZList<ZPage> > _small;
-  ZList<ZPage>            _medium;
+  ZPerNUMA<ZList<ZPage> > _medium;
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
 
@@ -167,6 +167,20 @@ public:
     return page;
   }
 
+  bool prefer_in_place_relocation(ZForwarding* forwarding, ZPage* target) {
+    // Relocate pages that are mostly garbage in-place when we have no
+    // partially filled target page yet. The few live objects are slid to
+    // the bottom of the page, avoiding the allocation of a fresh target
+    // page, and the remainder of the page becomes the target for
+    // subsequent relocations. Counts as an in-place relocation.
+    if (target != NULL || forwarding->live_bytes() >= forwarding->size() / 5) {
+      return false;
+    }
+
+    Atomic::inc(&_in_place_count);
+    return true;
+  }
+
   void share_target_page(ZPage* page) {
     // Does nothing
   }
@@ -214,6 +228,12 @@ public:
     }
   }
 
+  bool prefer_in_place_relocation(ZForwarding* forwarding, ZPage* target) const {
+    // Never prefer in-place relocation for medium pages, as that would
+    // interfere with the shared target page coordination below.
+    return false;
+  }
+
   ZPage* alloc_target_page(ZForwarding* forwarding, ZPage* target) {
     ZLocker<ZConditionLock> locker(&_lock);
 
@@ -353,6 +373,14 @@ public:
       return;
     }
 
+    // Check if the page should be relocated in-place right away instead of
+    // falling back to it when target page allocation fails.
+    if (_allocator->prefer_in_place_relocation(forwarding, _target)) {
+      _target = _forwarding->claim_page();
+      _target->reset_for_in_place_relocation();
+      _forwarding->set_in_place();
+    }
+
     // Relocate objects
     _forwarding->object_iterate(this);
 
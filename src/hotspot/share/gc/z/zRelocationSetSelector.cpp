@@ -92,13 +92,23 @@ void ZRelocationSetSelectorGroup::semi_sort() {
   const int npages = _live_pages.length();
   ZArray<ZPage*> sorted_live_pages(npages, npages, NULL);
 
-  // Sort pages into partitions
-  ZArrayIterator<ZPage*> iter2(&_live_pages);
-  for (ZPage* page; iter2.next(&page);) {
-    const size_t index = page->live_bytes() >> partition_size_shift;
-    const int finger = partitions[index]++;
-    assert(sorted_live_pages.at(finger) == NULL, "Invalid finger");
-    sorted_live_pages.at_put(finger, page);
+  // Sort pages into partitions. Within each partition, place young pages
+  // (allocated within the last cycle) before old pages. When the relocation
+  // set cut falls inside a partition this prefers relocating young pages,
+  // whose survivors are few and still being compacted, over old pages with
+  // long-lived, stable contents.
+  for (int pass = 0; pass < 2; pass++) {
+    const bool select_young = (pass == 0);
+    ZArrayIterator<ZPage*> iter2(&_live_pages);
+    for (ZPage* page; iter2.next(&page);) {
+      if (page->is_young() != select_young) {
+        continue;
+      }
+      const size_t index = page->live_bytes() >> partition_size_shift;
+      const int finger = partitions[index]++;
+      assert(sorted_live_pages.at(finger) == NULL, "Invalid finger");
+      sorted_live_pages.at_put(finger, page);
+    }
   }
 
   _live_pages.swap(&sorted_live_pages);
@@ -30,6 +30,16 @@
 
 // ------------------------------------------------------------------------------------------------
 // Non-product code
+//
+// These exact counts require a counting interpreter and distort timing,
+// which is why they are debug-build only.  For production visibility
+// the sampled equivalent already exists: the JFR execution sampler
+// attributes samples of interpreted frames to (method, bci) with no
+// dispatch-loop instrumentation, and the bci identifies the bytecode.
+// A dedicated bcp-sampling handshake would duplicate that pipeline with
+// the extra hazard of reading another thread's bcp, which is only valid
+// at the sample point because the handshake stops the thread anyway —
+// at which point it is the same cost as the sampler's stack walk.
 #ifndef PRODUCT
 
 // Implementation of BytecodeCounter
@@ -507,6 +507,15 @@ void Bytecodes::initialize() {
   def(_fast_lputfield      , "fast_lputfield"      , "bJJ"  , NULL    , T_LONG   ,  0, true , _putfield       );
   def(_fast_sputfield      , "fast_sputfield"      , "bJJ"  , NULL    , T_SHORT  ,  0, true , _putfield       );
 
+  // Superinstructions fusing two adjacent bytecodes into one dispatch:
+  // the access_0 family covers aload_0+getfield and fast_iload2 covers
+  // iload+iload.  They are selected at run time by the aload_0/iload
+  // templates peeking at the following bytecode, not by the Rewriter,
+  // because the profitable pairs are only known once the field access
+  // has been resolved to its fast form.  Each additional pair costs a
+  // template implementation in every platform's templateTable plus a
+  // case in the zero interpreter, which is why only the dominant pairs
+  // are fused.
   def(_fast_aload_0        , "fast_aload_0"        , "b"    , NULL    , T_OBJECT ,  1, true , _aload_0        );
   def(_fast_iaccess_0      , "fast_iaccess_0"      , "b_JJ" , NULL    , T_INT    ,  1, true , _aload_0        );
   def(_fast_aaccess_0      , "fast_aaccess_0"      , "b_JJ" , NULL    , T_OBJECT ,  1, true , _aload_0        );
@@ -32,6 +32,16 @@
 //
 // The counter is incremented before a method is activated and an
 // action is triggered when count() > limit().
+//
+// Counter updates are racy by design: the increment is a plain load/add/store
+// performed inline by the template interpreter and by C1-compiled prologues,
+// so concurrent activations of the same method may lose updates.  That is
+// acceptable because the counts only feed compilation heuristics.  Striping
+// the counter per core (to avoid cache-line ping-pong on methods that are hot
+// on many threads at once) would require growing MethodCounters by a
+// per-stripe array and teaching every platform's interpreter and C1 stub
+// assembly to select a stripe before the inline increment; the single shared
+// word is kept because the increment sites are generated code on all ports.
 
 class InvocationCounter {
   friend class VMStructs;
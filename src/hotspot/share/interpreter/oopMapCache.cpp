@@ -496,6 +496,14 @@ void OopMapCache::flush_obsolete_entries() {
 
 // Called by GC for thread root scan during a safepoint only.  The other interpreted frame oopmaps
 // are generated locally and not cached.
+//
+// The read path is lock-free: entries are published with a CAS, probed
+// with acquire loads, and replaced entries are parked on _old_entries
+// until after the walk, so concurrent GC threads never block here.  A
+// further single-entry cache on Method itself would only pay off for
+// stacks that revisit the same (method, bci); it would cost a word in
+// every Method for a structure touched only inside safepoints, so it is
+// not obviously a good trade.
 void OopMapCache::lookup(const methodHandle& method,
                          int bci,
                          InterpreterOopMap* entry_for) {
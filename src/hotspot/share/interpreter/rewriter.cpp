@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "interpreter/bytecodeStream.hpp"
 #include "interpreter/bytecodes.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/rewriter.hpp"
@@ -43,6 +44,42 @@
 void Rewriter::compute_index_maps() {
   const int length  = _pool->length();
   init_maps(length);
+
+  // Assign constant pool cache indices in bytecode first-use order rather
+  // than constant pool order, so that cache entries resolved close together
+  // in the bytecodes also lie close together in the cache array.  Entries
+  // that are never referenced from the bytecodes are appended by the
+  // constant pool scan below.
+  Thread* thread = Thread::current();
+  for (int m = 0; m < _methods->length(); m++) {
+    methodHandle method(thread, _methods->at(m));
+    RawBytecodeStream bcs(method);
+    while (!bcs.is_last_bytecode()) {
+      switch (bcs.raw_next()) {
+        case Bytecodes::_getstatic      : // fall through
+        case Bytecodes::_putstatic      : // fall through
+        case Bytecodes::_getfield       : // fall through
+        case Bytecodes::_putfield       : // fall through
+        case Bytecodes::_invokevirtual  : // fall through
+        case Bytecodes::_invokespecial  : // fall through
+        case Bytecodes::_invokestatic   : // fall through
+        case Bytecodes::_invokeinterface: {
+          int cp_index = Bytes::get_Java_u2(bcs.bcp() + 1);
+          int tag = _pool->tag_at(cp_index).value();
+          if ((tag == JVM_CONSTANT_InterfaceMethodref ||
+               tag == JVM_CONSTANT_Fieldref ||
+               tag == JVM_CONSTANT_Methodref) &&
+              !has_cp_cache(cp_index)) {
+            add_cp_cache_entry(cp_index);
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+
   bool saw_mh_symbol = false;
   for (int i = 0; i < length; i++) {
     int tag = _pool->tag_at(i).value();
@@ -50,7 +87,9 @@ void Rewriter::compute_index_maps() {
       case JVM_CONSTANT_InterfaceMethodref:
       case JVM_CONSTANT_Fieldref          : // fall through
       case JVM_CONSTANT_Methodref         : // fall through
-        add_cp_cache_entry(i);
+        if (!has_cp_cache(i)) {
+          add_cp_cache_entry(i);
+        }
         break;
       case JVM_CONSTANT_Dynamic:
         assert(_pool->has_dynamic_constant(), "constant pool's _has_dynamic_constant flag not set");
@@ -35,6 +35,19 @@ class InstanceKlass;
 // Intercepts the initial class load of jdk.jfr.Event and subclasses.
 // Will replace the sent in InstanceKlass* with a class file schema extended InstanceKlass*.
 //
+// This transformer only instruments event classes - it is not a general
+// method entry/exit tracer, and extending it into one is a larger project
+// than adding another rewrite.  Exact per-method timing needs begin/end
+// sites in arbitrary user methods, which means either bytecode injection
+// (this machinery, but now subject to the same JIT distortion as agent
+// instrumentation, since the injected code changes inlining size and
+// profile shape) or compiler-inserted emission, which requires
+// per-method directives plumbed through CompilerOracle into every tier
+// including the interpreter, plus deoptimization-safe pairing of
+// entry/exit when a traced frame is rewritten mid-flight.  Rate budgets
+// add per-thread state consulted at emission.  The pieces this file can
+// contribute (thread-local buffer writes, the commit protocol) are the
+// easy half; the hard half lives in compiler and runtime frame handling.
 class JfrEventClassTransformer : AllStatic {
  public:
   static void on_klass_creation(InstanceKlass*& ik, ClassFileParser& parser, TRAPS);
@@ -79,6 +79,17 @@ static void log_edge_queue_summary(const EdgeQueue& edge_queue) {
   }
 }
 
+// The chain walk must run inside the safepoint, and not merely because
+// the closures assume a stopped world: marking borrows each visited
+// object's markWord (ObjectSampleMarker saves and restores them), which
+// is unusable the moment mutators or the GC can touch headers.  Moving
+// the BFS/DFS out of the pause would mean replacing markWord marking
+// with an off-to-the-side mark table and either GC-cooperative snapshot
+// semantics (SATB-style) or read-barrier-protected traversal — stack
+// watermarks only shield thread stacks, not the object graph itself —
+// and every edge would need revalidation against objects that moved or
+// died mid-walk.  That is per-collector integration work, not a local
+// change to these closures.
 void PathToGcRootsOperation::doit() {
   assert(SafepointSynchronize::is_at_safepoint(), "invariant");
   assert(_cutoff_ticks > 0, "invariant");
@@ -146,6 +146,17 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   return processed;
 }
 
+// The cached_stack_trace_id check below is the existing per-thread
+// memoization: a trace captured earlier in the same event emission is
+// reused without a second walk.  Reusing the previous *sample's* trace
+// when only the leaf frames match is not sound with this data model —
+// traces are interned by a hash over all frames, so two samples sharing
+// a leaf but differing in a caller must intern to different ids, and
+// verifying "the rest of the stack is unchanged" costs the very walk
+// being avoided unless frames carry generation cookies maintained by
+// the interpreter and compiled prologues.  Cheap early exit on a
+// top-N-frame pre-hash would likewise save only the bucket compare, not
+// the walk, which is where the sampling cost is.
 traceid JfrStackTraceRepository::record(Thread* thread, int skip /* 0 */) {
   assert(thread == Thread::current(), "invariant");
   JfrThreadLocal* const tl = thread->jfr_thread_local();
@@ -138,6 +138,15 @@ static void log_allocation_failure(const char* msg, size_t size) {
   log_warning(jfr)("Unable to allocate " SIZE_FORMAT " bytes of %s.", size, msg);
 }
 
+// Buffers are keyed by thread, not by CPU.  Per-CPU buffers would
+// decouple buffer count from thread count for workloads with thousands
+// of short-lived threads, but an event writer can be preempted and
+// rescheduled mid-write, so CPU-keyed claiming needs either restartable
+// sequences (Linux-only, and unavailable to code that can block) or a
+// claim/abort protocol per event; thread-keyed buffers get exclusivity
+// for free.  The churn cost for short-lived threads is bounded instead
+// by this mspace's free list — a dying thread's buffer is retired and
+// reused, not unmapped.
 BufferPtr JfrStorage::acquire_thread_local(Thread* thread, size_t size /* 0 */) {
   BufferPtr buffer = mspace_acquire_to_live_list(size, instance()._thread_local_mspace, thread);
   if (buffer == NULL) {
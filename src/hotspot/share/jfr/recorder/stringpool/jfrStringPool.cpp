@@ -184,6 +184,15 @@ typedef ReleaseWithExcisionOp<JfrStringPoolMspace, JfrStringPoolMspace::LiveList
 typedef CompositeOperation<ExclusiveWriteOperation, ReleaseOperation> WriteReleaseOperation;
 typedef CompositeOperation<ExclusiveDiscardOperation, ReleaseOperation> DiscardReleaseOperation;
 
+// Rotation does not drain under a pool-wide lock: producers write into
+// leased mspace buffers and this pass claims each buffer individually
+// via ExclusiveOp, so the window in which a producer can stall is a
+// single buffer handover.  What a producer can still observe during
+// serialization is lease starvation when the live list is long.  Epoch
+// sharding in the style of JfrTraceIdEpoch would remove even that, but
+// it needs two live lists with the shift tied into the epoch-shift
+// safepoint so in-flight leases provably belong to the previous epoch
+// before it is serialized.
 size_t JfrStringPool::write() {
   Thread* const thread = Thread::current();
   WriteOperation wo(_chunkwriter, thread);
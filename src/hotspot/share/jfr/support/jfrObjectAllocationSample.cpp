@@ -101,6 +101,15 @@ static void normalize_as_tlab_and_send_allocation_samples(const Klass* klass, in
   } while (obj_alloc_size_bytes > 0);
 }
 
+// Bounded-overhead allocation profiling lives here: should_commit() for
+// this event goes through JfrEventThrottler, whose adaptive sampler
+// enforces a hard events/sec budget no matter how fast threads allocate,
+// with the weight field preserving an unbiased bytes estimate.  Sample
+// *candidates* are still TLAB-refill keyed because that hook costs
+// nothing on the inline allocation path; driving candidates from
+// ThreadHeapSampler's per-thread byte countdown instead would decouple
+// the pick distribution from TLAB sizing, but requires the sampler
+// check on every allocation rather than only at refill.
 void JfrObjectAllocationSample::send_event(const Klass* klass, size_t alloc_size, bool outside_tlab, Thread* thread) {
   if (outside_tlab) {
     normalize_as_tlab_and_send_allocation_samples(klass, static_cast<intptr_t>(alloc_size), thread);
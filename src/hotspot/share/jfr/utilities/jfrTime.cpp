@@ -31,6 +31,17 @@
 
 #include OS_HEADER_INLINE(os)
 
+// This is the VM's TSC-based fast clock: with -XX:+UseFastUnorderedTimeStamps
+// on x86, Rdtsc::initialize() verifies invariant-TSC support, calibrates a
+// frequency, and JFR ticks then read rdtsc directly instead of going through
+// the clock_gettime vDSO (or a syscall on hosts where the kernel has
+// demoted the clocksource).  It is deliberately not promoted into
+// os::javaTimeNanos(): "unordered" in the flag name is the contract.
+// Timestamps from different threads may appear out of order across cores
+// whose TSCs are not synchronized, and periodic recalibration (e.g. by the
+// WatcherThread) can bound drift but cannot restore cross-CPU ordering.
+// JFR tolerates that - events carry a thread id and consumers sort - but
+// javaTimeNanos() callers rely on a single monotonic timeline.
 bool JfrTime::_ft_enabled = false;
 
 bool JfrTime::initialize() {
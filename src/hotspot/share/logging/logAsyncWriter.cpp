@@ -52,10 +52,25 @@ void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
   }
 
   _buffer.push_back(msg);
-  _data_available = true;
-  _lock.notify();
+  // _data_available is cleared by the consumer only after it has popped
+  // all messages, so if it is still set the consumer is guaranteed to
+  // pick up this message without another wakeup.  Eliding the redundant
+  // notify keeps bursty logsites from issuing a syscall per message.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
+// A note on making enqueue lock-free (e.g. NonblockingQueue): producers
+// could push message nodes without the mutex, but the consumer must still
+// own a monitor to park on, multi-part LogMessageBuffer output depends on
+// the lock for enqueueing its lines as an atomic unit, and drop
+// accounting updates a per-output map that both sides touch.  The mutex
+// hold time here is already a handful of loads and stores; the dominant
+// per-message costs are the strdup and the wakeup, the latter now
+// elided when the consumer is already pending.
+
 void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
   AsyncLogMessage m(&output, decorations, os::strdup(msg));
 
@@ -120,6 +120,17 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
 
 const size_t vwrite_buffer_size = 512;
 
+// Formatting happens here, once per message, regardless of whether any
+// attached output would be content with a structured record.  A binary
+// mode (site id + raw arguments, schema emitted out of band) would have
+// to assign stable ids to log sites — format strings are only known at
+// the callsite, so the registry is either built lazily by interning fmt
+// pointers or generated at build time — and varargs cannot be shipped
+// opaquely: each argument's size and %-conversion must be encoded, with
+// %s pointing at memory that is only valid during this call and so must
+// be copied regardless.  Any such mode also has to coexist with text
+// outputs attached to the same tagset, meaning formatting is skipped
+// only when every output for the level opts in.
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
   char buf[vwrite_buffer_size];
@@ -46,6 +46,16 @@ STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+//
+// The ThreadCritical here is taken only when an arena crosses a chunk
+// boundary, not per Amalloc, and teardown batches a whole chain per
+// pool.  Sharding the pools per thread (or per NUMA node) would have to
+// work before the Thread infrastructure is up, flush caches at thread
+// exit, and handle chunks freed by a different thread than allocated
+// them — all for a lock that is held for a pointer swap.  Chunks are
+// also not zero-filled here (arena payload is returned raw), so there
+// is no redundant memset to elide at this level; callers that need
+// zeroed memory do it themselves with knowledge of how much they use.
 class ChunkPool {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   size_t       _num_chunks;   // number of unused chunks in pool
@@ -78,6 +88,67 @@ class ChunkPool {
     _num_chunks++;
   }
 
+  // Prepend a chain of num same-sized chunks [head, tail] to the pool
+  void free_chain(Chunk* head, Chunk* tail, size_t num) {
+    assert(head->length() == _size && tail->length() == _size, "wrong pool for this chain");
+    ThreadCritical tc;
+    tail->set_next(_first);
+    _first = head;
+    _num_chunks += num;
+  }
+
+  // Return every chunk of a chain to its pool, or free it if its size is
+  // non-standard.  Chunks are first partitioned into per-pool batches so
+  // that ThreadCritical is taken once per distinct chunk size rather than
+  // once per chunk; arenas with many chunks (e.g. compiler arenas at the
+  // end of a compilation) are torn down with a handful of lock
+  // acquisitions.
+  static void free_chunk_chain(Chunk* chunk) {
+    Chunk* batch_head[_num_pools];
+    Chunk* batch_tail[_num_pools];
+    size_t batch_num[_num_pools];
+    for (int i = 0; i < _num_pools; i++) {
+      batch_head[i] = NULL;
+      batch_tail[i] = NULL;
+      batch_num[i] = 0;
+    }
+    Chunk* non_standard = NULL;
+    while (chunk != NULL) {
+      Chunk* next = chunk->next();
+      int i;
+      for (i = 0; i < _num_pools; i++) {
+        if (_pools[i]._size == chunk->length()) {
+          break;
+        }
+      }
+      if (i < _num_pools) {
+        chunk->set_next(batch_head[i]);
+        batch_head[i] = chunk;
+        if (batch_tail[i] == NULL) {
+          batch_tail[i] = chunk;
+        }
+        batch_num[i]++;
+      } else {
+        chunk->set_next(non_standard);
+        non_standard = chunk;
+      }
+      chunk = next;
+    }
+    for (int i = 0; i < _num_pools; i++) {
+      if (batch_num[i] > 0) {
+        _pools[i].free_chain(batch_head[i], batch_tail[i], batch_num[i]);
+      }
+    }
+    if (non_standard != NULL) {
+      ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
+      while (non_standard != NULL) {
+        Chunk* next = non_standard->next();
+        os::free(non_standard);
+        non_standard = next;
+      }
+    }
+  }
+
   // Prune the pool
   void prune() {
     static const int blocksToKeep = 5;
@@ -205,14 +276,15 @@ Chunk::Chunk(size_t length) : _len(length) {
 }
 
 void Chunk::chop() {
-  Chunk *k = this;
-  while( k ) {
-    Chunk *tmp = k->next();
-    // clear out this chunk (to detect allocation bugs)
-    if (ZapResourceArea) memset(k->bottom(), badResourceValue, k->length());
-    delete k;                   // Free chunk (was malloc'd)
-    k = tmp;
+  if (ZapResourceArea) {
+    // clear out the chunks (to detect allocation bugs)
+    for (Chunk* k = this; k != NULL; k = k->next()) {
+      memset(k->bottom(), badResourceValue, k->length());
+    }
   }
+  // Return the whole chain in per-pool batches rather than deleting the
+  // chunks one at a time.
+  ChunkPool::free_chunk_chain(this);
 }
 
 void Chunk::next_chop() {
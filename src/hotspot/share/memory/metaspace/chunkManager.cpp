@@ -304,6 +304,18 @@ static void print_word_size_delta(outputStream* st, size_t word_size_1, size_t w
   }
 }
 
+// Maintenance is deliberately event-driven rather than a background
+// task: buddies are merged eagerly in return_chunk_locked() the moment
+// a loader dies, and this purge uncommits granule-sized free chunks
+// when invoked (class unloading, VM.metaspace).  A periodic walker
+// would find nothing the eager merge has not already folded; what it
+// cannot fix is live fragmentation — a surviving arena pinning a small
+// chunk inside an otherwise free root chunk — and that is only solvable
+// by relocating live metadata, not by freelist maintenance.  Note also
+// that deallocated-block remnants (FreeBlocks) are intentionally
+// arena-local: sharing them across arenas would break the property that
+// a loader's death returns whole chunks with no cross-loader pointers
+// into them.
 void ChunkManager::purge() {
   MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
   UL(info, ": reclaiming memory...");
@@ -39,6 +39,20 @@
 // safepoint by the ICBuffer logic.  It's unsafe to free them earlier
 // since they might be in use.
 //
+// Embedding a hashed (receiver klass -> target) table here for
+// megamorphic interface calls has been considered and rejected.  Holders
+// are reachable from executing code at all times, so table updates would
+// race with lookups from compiled frames that cannot be stopped, and
+// class unloading - which today only has to check the two fields above
+// via is_loader_alive() - would have to sweep every entry of every
+// holder's table for dead klasses.  The precedent this VM uses for
+// memoizing a per-receiver lookup is a single racily-updated word in the
+// Klass itself (cf. secondary_super_cache for subtype checks); an itable
+// analog there would cache the last (interface, offset) resolution per
+// receiver class, need no sweeping, and help every call site at once,
+// making it the better shape for the rare sites C2's profile-guided
+// bimorphic inlining cannot cover.
+//
 
 
 class CompiledICHolder : public CHeapObj<mtCompiler> {
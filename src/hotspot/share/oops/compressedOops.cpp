@@ -45,6 +45,17 @@ MemRegion       CompressedOops::_heap_address_range;
 // ZeroBased - Use zero based compressed oops with encoding when
 //     NarrowOopHeapBaseMin + heap_size < 32Gb
 // HeapBased - Use compressed oops with heap base + encoding.
+//
+// All modes share one property: decode is pure arithmetic (base +
+// (narrow << shift)) with base and shift burned into generated code as
+// constants, which is what lets every oop load in compiled code stay a
+// single instruction or two.  A segmented scheme — 32-bit offsets
+// against a per-region base table — would make decode a table load on
+// every reference touch, in the interpreter, both compilers, and every
+// GC barrier, and would break implicit null checks (a null narrow oop
+// must decode to an unmapped address).  The supported way to keep
+// 32-bit oops past 32 GB is already here: raising ObjectAlignmentInBytes
+// to 16 extends the shift to cover 64 GB at the cost of alignment waste.
 void CompressedOops::initialize(const ReservedHeapSpace& heap_space) {
 #ifdef _LP64
   // Subtract a page because something can get allocated at heap base.
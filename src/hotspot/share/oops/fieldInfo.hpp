@@ -36,6 +36,18 @@
 // array type.  FieldInfo generally shouldn't be used directly.
 // Fields should be queried either through InstanceKlass or through
 // the various FieldStreams.
+//
+// The flat u2 layout wastes metaspace on the common small values (most
+// name/signature indices and offsets fit in a byte) and a varint-coded
+// stream would roughly halve it.  Moving to such a stream is not a local
+// change, however: the offset slot is overwritten in place during field
+// layout, JVMTI RedefineClasses and the fieldDescriptor code index fields
+// randomly rather than sequentially, and the generic-signature slots are
+// conditionally appended per field (see the allocation in
+// ClassFileParser::parse_fields).  Any compressed format therefore needs
+// either a side index or decode cache for random access and a writable
+// fixup pass for layout, and has to be mirrored in the serviceability
+// agent's layout knowledge.
 class FieldInfo {
   friend class fieldDescriptor;
   friend class JavaFieldStream;
@@ -928,6 +928,17 @@ bool InstanceKlass::link_class_impl(TRAPS) {
       // relocate jsrs and link methods after they are all rewritten
       link_methods(CHECK_false);
 
+      // Note that constant pool cache entries deliberately stay
+      // unresolved here even for shared classes whose resolution
+      // outcome is deterministic.  Resolving eagerly would change
+      // observable behavior: linkage errors must surface at first use
+      // of the offending entry, field/method resolution can force
+      // loading of classes this class never touches at run time, and
+      // invokedynamic resolution executes user bootstrap methods.
+      // Pre-resolution from the archive would have to be limited to
+      // entries whose resolution is provably side-effect free and
+      // whose targets are themselves archived.
+
       // Initialize the vtable and interface table after
       // methods have been rewritten since rewrite may
       // fabricate new Method*s.
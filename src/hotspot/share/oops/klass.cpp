@@ -109,6 +109,17 @@ void Klass::release_C_heap_structures(bool release_constant_pool) {
   if (_name != NULL) _name->decrement_refcount();
 }
 
+// The linear scan below is the slow path behind the one-element
+// _secondary_super_cache; it is also emitted by the compilers in the
+// checkcast/instanceof stubs.  Replacing it with an O(1) structure (a
+// per-Klass bitmap over a compact global interface ID space, or hashed
+// secondary supers) is attractive for interface-heavy code, but the ID
+// space must survive arbitrary class loading and unloading, every
+// Klass's table must be rebuildable when the space is recompacted, and
+// the compiled fast paths on all platforms encode the current layout of
+// _secondary_supers and _secondary_super_cache, so the change has to be
+// made in lock-step across the runtime, the interpreter stubs and every
+// compiler back end.
 bool Klass::search_secondary_supers(Klass* k) const {
   // Put some extra logic here out-of-line, before the search proper.
   // This cuts down the size of the inline method.
@@ -159,6 +159,13 @@ int klassVtable::initialize_from_super(Klass* super) {
 
 //
 // Revised lookup semantics   introduced 1.3 (Kestrel beta)
+//
+// For CDS-archived classes this computation usually does not run at all:
+// the vtable computed at dump time is archived with the class, and
+// link_class_impl reuses it when the class was verified at dump time and
+// its archived loader constraints hold (see need_init_table there).
+// This code is the dump-time producer and the fallback for custom
+// loaders or constraint failures.
 void klassVtable::initialize_vtable(GrowableArray<InstanceKlass*>* supers) {
 
   // Note:  Arrays can have intermediate array supers.  Use java_super to skip them.
@@ -60,6 +60,19 @@
 //  - INFLATING() is a distinguished markword value of all zeros that is
 //    used when inflating an existing stack-lock into an ObjectMonitor.
 //    See below for is_being_inflated() and INFLATING().
+//
+// On shrinking the header below markWord + compressed klass: the markWord
+// cannot simply lose bits, because three mechanisms overload the whole
+// word with a native pointer - stack locks store the displaced header
+// address, inflated locks the ObjectMonitor address, and GC forwarding
+// the to-space address - and each relies on the remaining bits (hash,
+// age) being displaced into the pointed-to location.  A 4-byte mark would
+// need the identity hash moved to an on-demand sidecar keyed by object
+// address (and re-keyed by every moving collector), locking to stop
+// displacing the header, and forwarding pointers stored elsewhere.  That
+// touches the interpreter and compiler lock fast paths on every platform
+// plus every collector's relocation code, so it is a header-format
+// project in its own right, not an incremental change to this class.
 
 class BasicLock;
 class ObjectMonitor;
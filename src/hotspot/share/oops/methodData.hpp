@@ -66,6 +66,15 @@ class BytecodeStream;
 // The reader will find many data races in profile gathering code, starting
 // with invocation counter incrementation.  None of these races harm correct
 // execution of the compiled code.
+//
+// The profile is inherently process-local.  Receiver-type and speculative
+// entries store raw Klass* and Method* pointers that are only meaningful
+// in this process (and are weak-cleared when their metadata is unloaded),
+// and the per-BCI layout is derived from the rewritten bytecodes.
+// Persisting an MDO across runs therefore means translating those
+// pointers to symbolic form and back at link time, and validating that
+// the class bytes still match — it is not a matter of writing the blob
+// to disk.
 
 // forward decl
 class ProfileData;
@@ -480,6 +489,17 @@ public:
 // BitData
 //
 // A BitData holds a flag or two in its header.
+//
+// The flags are monotonic: once set they are never cleared, and the
+// compilers only consume them as "was this ever seen".  The interpreter
+// and profiled C1 code nevertheless re-store them unconditionally on
+// every execution of the bytecode, which keeps the profile line dirty in
+// hot loops.  Making the store conditional (load, test, skip) or patching
+// the profiling code out once the flag is set would have to be done in
+// each platform's interp_masm/C1 profiling sequences, and the extra
+// branch is itself not obviously cheaper than the blind store on
+// machines with write-combining stores — any change here needs
+// per-platform measurement, not just shared-code edits.
 class BitData : public ProfileData {
   friend class VMStructs;
   friend class JVMCIVMStructs;
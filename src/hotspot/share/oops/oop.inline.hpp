@@ -161,6 +161,14 @@ size_t oopDesc::size_given_klass(Klass* klass)  {
   // heart of phase 2 of mark-compaction, and called for every object,
   // alive or dead.  So the speed here is equal in importance to the
   // speed of allocation.
+  //
+  // Per object this is two well-predicted branches on a value already
+  // in the Klass cache line the caller loaded to dispatch iteration;
+  // making scan loops monomorphic per klass has to come from the loop
+  // side (e.g. a scanner specializing runs of same-klass objects it
+  // discovers while walking), not from extra indirection here — a
+  // dispatch table keyed on klass category would replace predictable
+  // branches with a dependent load.
 
   if (lh > Klass::_lh_neutral_value) {
     if (!Klass::layout_helper_needs_slow_path(lh)) {
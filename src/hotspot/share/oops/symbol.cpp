@@ -286,6 +286,20 @@ void Symbol::print_as_signature_external_parameters(outputStream *os) {
 // Increment refcount while checking for zero.  If the Symbol's refcount becomes zero
 // a thread could be concurrently removing the Symbol.  This is used during SymbolTable
 // lookup to avoid reviving a dead Symbol.
+//
+// Two notes on the cost of this protocol.  First, symbols that are created
+// permanent or promoted by make_permanent() - all of vmSymbols and everything
+// in the CDS archive, which covers the names hit hardest during startup -
+// never reach the cmpxchg: PERM_REFCOUNT short-circuits to a plain load and
+// branch, so the "hot symbol" cache line only bounces for non-permanent
+// symbols.  Second, buffering refcount deltas per thread and flushing them
+// later is not compatible with the zero-means-dead rule these loops enforce.
+// Delayed decrements would merely postpone reclamation, but a delayed
+// increment leaves the shared count understating the true number of
+// holders, and SymbolTable cleanup concurrently deletes any entry it
+// observes at zero - it has no way to ask every thread for unflushed
+// deltas.  Making that safe would reintroduce a stop-the-world component
+// into a path that is otherwise fully concurrent.
 bool Symbol::try_increment_refcount() {
   uint32_t found = _hash_and_refcount;
   while (true) {
@@ -187,7 +187,9 @@
            "Superword Level Parallelism analysis")                          \
                                                                             \
   product(bool, PostLoopMultiversioning, false, EXPERIMENTAL,               \
-           "Multi versioned post loops to eliminate range checks")          \
+           "Multi versioned post loops to eliminate range checks and, "     \
+           "on targets with predicated vectors, replace the scalar drain "  \
+           "loop with a single masked vector iteration")                    \
                                                                             \
   notproduct(bool, TraceSuperWordLoopUnrollAnalysis, false,                 \
           "Trace what Superword Level Parallelism analysis applies")        \
@@ -903,6 +903,18 @@ public:
 //  order to differentiate the uses of the projection on the normal control path from
 //  those on the exception return path.
 //
+// Each allocation is its own node even when escape analysis can prove a
+// parent and a child it always creates (wrapper plus backing array) are
+// born and die together.  Fusing such pairs into one TLAB bump is
+// tempting for locality but collides with invariants that everything
+// downstream assumes: the two oops must remain separately forwardable
+// (any moving collector may relocate one without the other), each needs
+// its own header and klass for size/iterate during heap walks, and the
+// deoptimization state rematerializes them as distinct objects.  A
+// contiguous-placement *hint* (allocate back-to-back without merging
+// identities) is the version of this that does not fight the GC, and
+// even that needs the slow path to tolerate the pair straddling a TLAB
+// boundary.
 class AllocateNode : public CallNode {
 public:
   enum {
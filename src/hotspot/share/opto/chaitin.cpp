@@ -220,42 +220,46 @@ PhaseChaitin::PhaseChaitin(uint unique, PhaseCFG &cfg, Matcher &matcher, bool sc
 
   _high_frequency_lrg = MIN2(double(OPTO_LRG_HIGH_FREQ), _cfg.get_outer_loop_frequency());
 
-  // Build a list of basic blocks, sorted by frequency
+  // Build a list of basic blocks, sorted by frequency, with a two-pass
+  // counting sort: one pass to size the buckets, then place blocks into
+  // _blks directly.  This avoids allocating and clearing a full-size
+  // block array per bucket, which adds up on very large methods.
   _blks = NEW_RESOURCE_ARRAY(Block *, _cfg.number_of_blocks());
-  // Experiment with sorting strategies to speed compilation
   double  cutoff = BLOCK_FREQUENCY(1.0); // Cutoff for high frequency bucket
-  Block **buckets[NUMBUCKS];             // Array of buckets
   uint    buckcnt[NUMBUCKS];             // Array of bucket counters
   double  buckval[NUMBUCKS];             // Array of bucket value cutoffs
   for (uint i = 0; i < NUMBUCKS; i++) {
-    buckets[i] = NEW_RESOURCE_ARRAY(Block *, _cfg.number_of_blocks());
     buckcnt[i] = 0;
     // Bump by three orders of magnitude each time
     cutoff *= 0.001;
     buckval[i] = cutoff;
-    for (uint j = 0; j < _cfg.number_of_blocks(); j++) {
-      buckets[i][j] = NULL;
-    }
   }
-  // Sort blocks into buckets
+  // Count blocks per bucket
   for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
     for (uint j = 0; j < NUMBUCKS; j++) {
       if ((j == NUMBUCKS - 1) || (_cfg.get_block(i)->_freq > buckval[j])) {
-        // Assign block to end of list for appropriate bucket
-        buckets[j][buckcnt[j]++] = _cfg.get_block(i);
+        buckcnt[j]++;
         break; // kick out of inner loop
       }
     }
   }
-  // Dump buckets into final block array
+  // Compute starting index of each bucket in the final block array
+  uint buckstart[NUMBUCKS];
   uint blkcnt = 0;
   for (uint i = 0; i < NUMBUCKS; i++) {
-    for (uint j = 0; j < buckcnt[i]; j++) {
-      _blks[blkcnt++] = buckets[i][j];
-    }
+    buckstart[i] = blkcnt;
+    blkcnt += buckcnt[i];
   }
-
   assert(blkcnt == _cfg.number_of_blocks(), "Block array not totally filled");
+  // Place blocks, preserving block order within each bucket
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    for (uint j = 0; j < NUMBUCKS; j++) {
+      if ((j == NUMBUCKS - 1) || (_cfg.get_block(i)->_freq > buckval[j])) {
+        _blks[buckstart[j]++] = _cfg.get_block(i);
+        break; // kick out of inner loop
+      }
+    }
+  }
 }
 
 // union 2 sets together.
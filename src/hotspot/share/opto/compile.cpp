@@ -249,6 +249,7 @@ void Compile::print_statistics() {
   { ttyLocker ttyl;
     if (xtty != NULL)  xtty->head("statistics type='opto'");
     Parse::print_statistics();
+    PhaseIterGVN::print_statistics();
     PhaseCCP::print_statistics();
     PhaseRegAlloc::print_statistics();
     PhaseOutput::print_statistics();
@@ -1042,6 +1043,11 @@ void Compile::Init(int aliaslevel) {
   _alias_types[AliasIdxBot]->Init(AliasIdxBot, TypePtr::BOTTOM);
   _alias_types[AliasIdxRaw]->Init(AliasIdxRaw, TypeRawPtr::BOTTOM);
   _num_alias_types = AliasIdxRaw+1;
+  // Flattened alias types are interned (hash-consed), so pointer identity is
+  // type identity and a pointer-keyed map gives constant-time index lookup.
+  _flat_alias_map = new (comp_arena()) Dict(cmpkey, hashkey, comp_arena());
+  _flat_alias_map->Insert((void*)TypePtr::BOTTOM,    (void*)(intptr_t)AliasIdxBot);
+  _flat_alias_map->Insert((void*)TypeRawPtr::BOTTOM, (void*)(intptr_t)AliasIdxRaw);
   // Zero out the alias type cache.
   Copy::zero_to_bytes(_alias_cache, sizeof(_alias_cache));
   // A NULL adr_type hits in the cache right away.  Preload the right answer.
@@ -1607,13 +1613,11 @@ Compile::AliasType* Compile::find_alias_type(const TypePtr* adr_type, bool no_cr
   }
 #endif
 
-  int idx = AliasIdxTop;
-  for (int i = 0; i < num_alias_types(); i++) {
-    if (alias_type(i)->adr_type() == flat) {
-      idx = i;
-      break;
-    }
+  int idx = (int)(intptr_t)(*_flat_alias_map)[flat];
+  if (idx == 0) {
+    idx = AliasIdxTop;  // not interned yet
   }
+  assert(idx == AliasIdxTop || alias_type(idx)->adr_type() == flat, "stale interned index");
 
   if (idx == AliasIdxTop) {
     if (no_create)  return NULL;
@@ -1622,6 +1626,7 @@ Compile::AliasType* Compile::find_alias_type(const TypePtr* adr_type, bool no_cr
     // Add a new alias type.
     idx = _num_alias_types++;
     _alias_types[idx]->Init(idx, flat);
+    _flat_alias_map->Insert((void*)flat, (void*)(intptr_t)idx);
     if (flat == TypeInstPtr::KLASS)  alias_type(idx)->set_rewritable(false);
     if (flat == TypeAryPtr::RANGE)   alias_type(idx)->set_rewritable(false);
     if (flat->isa_instptr()) {
@@ -1917,6 +1922,32 @@ void Compile::inline_incrementally_cleanup(PhaseIterGVN& igvn) {
   print_method(PHASE_INCREMENTAL_INLINE_CLEANUP, 3);
 }
 
+// Estimate of the benefit per node of budget consumed by late inlining a
+// call site: prefer hot, small callees.  Uses the call site execution count
+// when the parser recorded one and falls back to the callee's interpreter
+// invocation count otherwise.
+static double late_inline_priority(CallGenerator* cg) {
+  ciMethod* callee = cg->method();
+  double count = (double)callee->interpreter_invocation_count();
+  CallNode* call = cg->call_node();
+  if (call != NULL && call->cnt() != COUNT_UNKNOWN) {
+    count = MAX2(count, (double)call->cnt());
+  }
+  return count / (double)MAX2(callee->code_size(), 1);
+}
+
+static int late_inline_compare(CallGenerator** a, CallGenerator** b) {
+  double pa = late_inline_priority(*a);
+  double pb = late_inline_priority(*b);
+  // Highest priority first
+  if (pa < pb) {
+    return 1;
+  } else if (pa > pb) {
+    return -1;
+  }
+  return 0;
+}
+
 // Perform incremental inlining until bound on number of live nodes is reached
 void Compile::inline_incrementally(PhaseIterGVN& igvn) {
   TracePhase tp("incrementalInline", &timers[_t_incrInline]);
@@ -1957,6 +1988,17 @@ void Compile::inline_incrementally(PhaseIterGVN& igvn) {
     for_igvn()->clear();
     initial_gvn()->replace_with(&igvn);
 
+    // Process the most profitable candidates first, so that if the node
+    // budget runs out the calls left on the list are the cold ones.
+    // No candidate is in flight here, but parse-time registration through
+    // add_late_inline() leaves the insertion cursor at the end of the
+    // list; reordering invalidates it, so reset it explicitly.
+    // inline_incrementally_one() re-establishes the cursor before use.
+    if (_late_inlines.length() > 1) {
+      _late_inlines_pos = 0;
+      _late_inlines.sort(late_inline_compare);
+    }
+
     while (inline_incrementally_one()) {
       assert(!failing(), "inconsistent");
     }
@@ -403,6 +403,7 @@ class Compile : public Phase {
   int                   _num_alias_types;       // Logical length of _alias_types
   int                   _max_alias_types;       // Physical length of _alias_types
   AliasCacheEntry       _alias_cache[AliasCacheSize]; // Gets aliases w/o data structure walking
+  Dict*                 _flat_alias_map;        // Maps flattened alias type to its index
 
   // Parsing, optimization
   PhaseGVN*             _initial_gvn;           // Results of parse-time PhaseGVN
@@ -109,6 +109,14 @@
 // is marked GlobalEscape.  Finally, for any node marked ArgEscape, anything
 // it could point to is marked ArgEscape.
 //
+// Because the analysis is flow-insensitive, escape states are path
+// joins: one escaping use on any path, however cold, makes the object
+// GlobalEscape and heap-allocated everywhere.  Scalar-replacing such an
+// object on the hot path would require materializing it at the cold
+// escape point, the same way deoptimization rematerializes scalar-replaced
+// objects (Deoptimization::realloc_objects), plus a flow-sensitive
+// escape state to know where materialization is required.
+//
 
 class  Compile;
 class  Node;
@@ -526,6 +526,22 @@ void GraphKit::uncommon_trap_if_should_post_on_exceptions(Deoptimization::DeoptR
 }
 
 //------------------------------builtin_throw----------------------------------
+// The preallocated-instance trick below is limited to implicit exceptions
+// for a reason.  For those, the VM itself conjures the exception object, so
+// substituting a shared stackless instance is invisible to the program
+// (modulo the backtrace, which OmitStackTraceInFastThrow gates).  An
+// explicit athrow throws an object that user bytecode already constructed —
+// Throwable.<init> has run, fill_in_stack_trace has been paid, and the
+// instance's identity, message and suppressed-exception state are all
+// observable — so there is no point at which the VM could swap in a cached
+// instance without changing program behavior.  The supported way to make
+// control-flow exceptions cheap on the user side is the same idiom this
+// code uses: construct once with writableStackTrace=false and rethrow the
+// cached instance; the allocation and trace fill then disappear from the
+// hot path without VM involvement.  Interpreter-side caching of implicit
+// throws buys little in practice: the trap profiling that detects a hot
+// throw site also makes the method a compilation candidate, after which
+// this path takes over.
 void GraphKit::builtin_throw(Deoptimization::DeoptReason reason, Node* arg) {
   bool must_throw = true;
 
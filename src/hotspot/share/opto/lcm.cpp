@@ -927,6 +927,21 @@ uint PhaseCFG::sched_call(Block* block, uint node_cnt, Node_List& worklist, Grow
 
 //------------------------------schedule_local---------------------------------
 // Topological sort within a block.  Someday become a real scheduler.
+//
+// Node latencies come from each port's adlc pipeline description, which
+// on out-of-order targets is closer to a priority heuristic than a
+// machine model - the hardware reorders within a window far larger than
+// a basic block, so the payoff from a faithful per-core model (issue
+// width, load-to-use, port maps) is concentrated on in-order cores, and
+// those ports already describe their pipelines in detail in their .ad
+// files.  That is also why the model lives in the matcher description
+// per port rather than as a shared VM_Version-keyed table: latencies are
+// per-MachNode, and only the port knows its own node inventory.  A
+// runtime override of scheduling weights via compiler directives would
+// need the pipeline tables to become mutable data rather than
+// adlc-generated constants; SuperWord's cost questions are separate and
+// already funnel through Matcher::match_rule_supported_vector and the
+// per-port vector cost hooks.
 bool PhaseCFG::schedule_local(Block* block, GrowableArray<int>& ready_cnt, VectorSet& next_call, intptr_t *recalc_pressure_nodes) {
   // Already "sorted" are the block start Node (as the first entry), and
   // the block-ending Node and any trailing control projections.  We leave
@@ -1097,6 +1097,12 @@ bool LibraryCallKit::inline_preconditions_checkIndex(BasicType bt) {
 }
 
 //------------------------------inline_string_indexOf------------------------
+// Intrinsified coder combinations are LL, UU and UL; there is no LU
+// variant because with compact strings a UTF16-coded needle contains at
+// least one char above 0xFF, which cannot occur in a Latin1 haystack, so
+// the library returns -1 without searching.  Needles longer than a
+// vector register are handled by the per-CPU StrIndexOf implementations,
+// which fall into a scalar tail loop rather than back to Java.
 bool LibraryCallKit::inline_string_indexOf(StrIntrinsicNode::ArgEnc ae) {
   if (!Matcher::match_rule_supported(Op_StrIndexOf)) {
     return false;
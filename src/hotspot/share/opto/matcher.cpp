@@ -185,6 +185,17 @@ void Matcher::verify_new_nodes_only(Node* xroot) {
 
 
 //---------------------------match---------------------------------------------
+// Note on parallelizing the backend: matching is logically independent per
+// block, and the same holds for much of global code motion and the
+// interference graph build, which makes intra-compile parallelism look
+// attractive for large methods.  In practice all of these phases allocate
+// Nodes and types through Compile::current(), which is thread-local, draw
+// memory from the single compile-lifetime arenas, and assign node indexes
+// from one shared counter.  Running them on worker threads therefore
+// requires per-worker node arenas with partitioned index ranges and a
+// handoff of the Compile TLS, not just a task pool.  Until that
+// restructuring happens, match() must run entirely on the owning
+// CompilerThread.
 void Matcher::match( ) {
   if( MaxLabelRootDepth < 100 ) { // Too small?
     assert(false, "invalid MaxLabelRootDepth, increase it to 100 minimum");
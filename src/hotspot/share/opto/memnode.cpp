@@ -1051,6 +1051,13 @@ Node* LoadNode::can_see_arraycopy_value(Node* st, PhaseGVN* phase) const {
 // same time (uses the Oracle model of aliasing), then some
 // LoadXNode::Identity will fold things back to the equivalence-class model
 // of aliasing.
+//
+// Note that this walk stops at any Java call: a call produces a fresh
+// memory state for every alias class it might modify, so a load in a loop
+// containing a call re-executes each iteration even when the callee never
+// touches the field.  Hoisting such loads would need per-callee modified
+// alias sets (or a purity assumption backed by dependency invalidation),
+// which the memory graph does not currently carry.
 Node* MemNode::can_see_stored_value(Node* st, PhaseTransform* phase) const {
   Node* ld_adr = in(MemNode::Address);
   intptr_t ld_off = 0;
@@ -1792,6 +1792,17 @@ void PhaseOutput::fill_buffer(CodeBuffer* cb, uint* blk_starts) {
   } // End of for all blocks
   blk_starts[nblocks] = current_offset;
 
+#ifndef PRODUCT
+  // Tally how many of the emitted bytes belong to cold blocks.
+  for (uint i = 0; i < nblocks; i++) {
+    uint blk_size = blk_starts[i + 1] - blk_starts[i];
+    _total_insts_size += blk_size;
+    if (C->cfg()->get_block(i)->_freq < BLOCK_FREQUENCY(0.0001)) {
+      _total_cold_insts_size += blk_size;
+    }
+  }
+#endif
+
   non_safepoints.flush_at_end();
 
   // Offset too large?
@@ -3607,7 +3618,15 @@ void PhaseOutput::dump_asm_on(outputStream* st, int* pcs, uint pc_limit) {
 #endif
 
 #ifndef PRODUCT
+uint PhaseOutput::_total_insts_size = 0;
+uint PhaseOutput::_total_cold_insts_size = 0;
+
 void PhaseOutput::print_statistics() {
+  if (_total_insts_size > 0) {
+    tty->print_cr("Output: %d bytes of instructions, %d in cold blocks (%.1f%%)",
+                  _total_insts_size, _total_cold_insts_size,
+                  100.0 * (double)_total_cold_insts_size / (double)_total_insts_size);
+  }
   Scheduling::print_statistics();
 }
 #endif
@@ -263,6 +263,12 @@ public:
   void BuildOopMaps();
 
 #ifndef PRODUCT
+  // Gather information on how much of the emitted instruction bytes sit
+  // in blocks the profile says are essentially never executed.  A large
+  // cold fraction is the precondition for hot/cold method splitting.
+  static uint _total_insts_size;
+  static uint _total_cold_insts_size;
+
   static void print_statistics();
 #endif
 };
@@ -1199,9 +1199,16 @@ void PhaseIterGVN::optimize() {
     DEBUG_ONLY(trace_PhaseIterGVN_verbose(n, num_processed++);)
     if (n->outcnt() != 0) {
       NOT_PRODUCT(const Type* oldtype = type_or_null(n));
+      NOT_PRODUCT(uint old_wlsize = _worklist.size());
       // Do the transformation
       Node* nn = transform_old(n);
-      NOT_PRODUCT(trace_PhaseIterGVN(n, nn, oldtype);)
+#ifndef PRODUCT
+      _total_transforms++;
+      if (nn == n && type_or_null(n) == oldtype && _worklist.size() == old_wlsize) {
+        _total_noop_transforms++;
+      }
+      trace_PhaseIterGVN(n, nn, oldtype);
+#endif
     } else if (!n->is_top()) {
       remove_dead_node(n);
     }
@@ -2001,6 +2008,14 @@ const Type* PhaseCCP::saturate(const Type* new_type, const Type* old_type,
 void PhaseCCP::print_statistics() {
   tty->print_cr("CCP: %d  constants found: %d", _total_invokes, _total_constants);
 }
+
+julong PhaseIterGVN::_total_transforms = 0;
+julong PhaseIterGVN::_total_noop_transforms = 0;
+
+void PhaseIterGVN::print_statistics() {
+  tty->print_cr("IterGVN: " JULONG_FORMAT " transforms, " JULONG_FORMAT " changed nothing",
+                _total_transforms, _total_noop_transforms);
+}
 #endif
 
 
@@ -551,7 +551,16 @@ public:
   bool no_dependent_zero_check(Node* n) const;
 
 #ifndef PRODUCT
+public:
+  static void print_statistics();
+
 protected:
+  // For profiling, count worklist pops that were transformed and pops
+  // where the transform changed nothing (node, type and worklist all
+  // unchanged).  The no-op fraction measures redundant re-transformation.
+  static julong _total_transforms;
+  static julong _total_noop_transforms;
+
   // Sub-quadratic implementation of VerifyIterativeGVN.
   julong _verify_counter;
   julong _verify_full_passes;
@@ -909,6 +909,17 @@ bool StringConcat::validate_mem_flow() {
   return true;
 }
 
+// Check that the control flow between the calls of the candidate chain
+// is simple enough to fuse.  Tolerated between the calls are the null
+// checks of append results, branches into uncommon traps, and regions
+// merging the projections of a single If (data-only diamonds, which
+// IGVN collapses).  A region with an append on only one of its arms is
+// rejected: fusing a conditional append would require selecting each
+// argument through a Phi, sizing the result for both arms, and proving
+// the memory state of the skipped arm is unchanged, none of which the
+// single-pass replacement below can express.  The same holds for
+// appends inside a loop, where the result size depends on the trip
+// count.
 bool StringConcat::validate_control_flow() {
   // We found all the calls and arguments now lets see if it's
   // safe to transform the graph as we would expect.
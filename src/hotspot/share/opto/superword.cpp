@@ -595,6 +595,7 @@ void SuperWord::find_adjacent_refs() {
   if (TraceSuperWord) {
     tty->print_cr("\nfind_adjacent_refs found %d memops", memops.size());
   }
+  NOT_PRODUCT(find_strided_refs_trace(memops);)
 
   Node_List align_to_refs;
   int max_idx;
@@ -783,6 +784,36 @@ void SuperWord::find_adjacent_refs_trace_1(Node* best_align_to_mem_ref, int best
        best_align_to_mem_ref->dump();
   }
 }
+
+// Report comparable memory references at a constant non-unit stride.  These
+// are rejected by are_adjacent_refs, but are the candidates that vector
+// gather/scatter support (LoadVectorGather/StoreVectorScatter) would pick
+// up; the trace output shows what a loop leaves on the table.
+void SuperWord::find_strided_refs_trace(Node_List &memops) {
+  if (!TraceSuperWord) {
+    return;
+  }
+  for (uint i = 0; i < memops.size(); i++) {
+    MemNode* s1 = memops.at(i)->as_Mem();
+    SWPointer p1(s1, this, NULL, false);
+    for (uint j = i + 1; j < memops.size(); j++) {
+      MemNode* s2 = memops.at(j)->as_Mem();
+      if (s1->Opcode() != s2->Opcode()) {
+        continue;
+      }
+      SWPointer p2(s2, this, NULL, false);
+      if (p1.base() != p2.base() || !p1.comparable(p2)) {
+        continue;
+      }
+      int diff = ABS(p2.offset_in_bytes() - p1.offset_in_bytes());
+      int size = data_size(s1);
+      if (diff > size && (diff % size) == 0) {
+        tty->print_cr("SuperWord::find_adjacent_refs: %d %d comparable at stride %d bytes, gather/scatter candidate",
+                      s1->_idx, s2->_idx, diff);
+      }
+    }
+  }
+}
 #endif
 
 //------------------------------find_align_to_ref---------------------------
@@ -1821,6 +1852,14 @@ void SuperWord::filter_packs() {
 //                   \ v /
 //                   CMoveD
 //
+// This is the only if-conversion SLP performs: simple diamonds that the
+// loop optimizer has already flattened into CMoveF/CMoveD become CMoveVF/
+// CMoveVD (blend) vectors when UseVectorCmov is enabled and the target
+// matches those rules.  Loops with residual control flow, and integer
+// CMoves, still bail out of vectorization: extending this to masked
+// vector operations needs blend/mask ideal nodes wired through
+// Matcher::match_rule_supported_vector_masked and a packing scheme that
+// keeps both diamond arms in lockstep.
 
 void SuperWord::merge_packs_to_cmovd() {
   for (int i = _packset.length() - 1; i >= 0; i--) {
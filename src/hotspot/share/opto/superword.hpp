@@ -428,6 +428,7 @@ class SuperWord : public ResourceObj {
   // Tracing support
   #ifndef PRODUCT
   void find_adjacent_refs_trace_1(Node* best_align_to_mem_ref, int best_iv_adjustment);
+  void find_strided_refs_trace(Node_List &memops);
   void print_loop(bool whole);
   #endif
   // Find a memory reference to align the loop induction variable to.
@@ -165,6 +165,18 @@ void VM_RedefineClasses::unlock_classes() {
   ml.notify_all();
 }
 
+// Nearly all of the expensive redefinition work already happens here, on
+// the requesting thread before the safepoint is scheduled: class file
+// parsing, both verification passes and merge_cp_and_rewrite() all run
+// from load_new_class_versions() below, and the safepointed doit() only
+// installs the prepared scratch classes and adjusts dependents.  When a
+// redefinition pause is long, the cost is in doit()'s flushing of
+// dependent compiled code and the method/vtable fixups, not in merging or
+// verification.  Splitting merge_constant_pools by entry type would not
+// help a pause for the same reason, and caching merge results across the
+// re-instrumentation of a class is not straightforward: each redefinition
+// replaces the old class's constant pool, so the cached mapping would be
+// keyed to a constant pool that no longer exists after the first install.
 bool VM_RedefineClasses::doit_prologue() {
   if (_class_count == 0) {
     _res = JVMTI_ERROR_NONE;
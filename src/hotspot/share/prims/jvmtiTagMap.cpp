@@ -350,6 +350,17 @@ class TwoOopCallbackWrapper : public CallbackWrapper {
 // This function is performance critical. If many threads attempt to tag objects
 // around the same time then it's possible that the Mutex associated with the
 // tag map will be a hot lock.
+//
+// Making get/set lock-free is harder than swapping in a concurrent map:
+// the entries key on WeakHandles whose referents the GC clears, and
+// remove_dead_entries() rehashes and unlinks under this same lock, so a
+// lock-free reader must tolerate entries whose key oop is concurrently
+// nulled and whose node is concurrently excised — a ConcurrentHashTable
+// with GlobalCounter-protected readers fits, but the posting protocol
+// (ObjectFree events driven from dead entries) must then be decoupled
+// from table maintenance.  The heap walks below are a separate problem:
+// they are VM operations because the callbacks see an object graph that
+// must not mutate mid-walk, which handshakes alone do not provide.
 void JvmtiTagMap::set_tag(jobject object, jlong tag) {
   MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
 
@@ -369,6 +369,14 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, j
   Copy::fill_to_memory_atomic(p, sz, value);
 } UNSAFE_END
 
+// Large copies take the unsafe_arraycopy stub, which each platform's
+// stub generator already specializes by alignment; element atomicity is
+// only preserved at the granularity the addresses allow, so there is no
+// per-element overhead left to shave on 8-byte-aligned copies.  A
+// non-temporal variant for LLC-sized copies is a stub-generator change
+// per platform plus a new jdk.internal.misc.Unsafe entry so callers opt
+// in explicitly — NT stores require the caller to not read the
+// destination soon, which this blind entry point cannot infer.
 UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
   size_t sz = (size_t)size;
 
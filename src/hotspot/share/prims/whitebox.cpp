@@ -972,6 +972,17 @@ WB_ENTRY(jboolean, WB_TestSetDontInlineMethod(JNIEnv* env, jobject o, jobject me
   return result;
 WB_END
 
+// Each WB_ENTRY pays a full JNI transition, which makes these entries
+// unsuitable as high-rate probes.  A separate mmap'd "fast stats" struct
+// would duplicate machinery that already exists: the PerfMemory region is
+// exactly that page - compile queue depths, code cache usage and GC times
+// are published there as lock-free jlong slots, readable in-process
+// through jdk.internal.perf.Perf's ByteBuffer view (or out-of-process by
+// attaching, as jstat does) with no JNI call per sample.  The entries are
+// self-describing rather than at fixed offsets; a reader resolves the
+// names it wants once and caches the slot offsets, which is stable
+// because entries are never moved or removed.  Harnesses needing
+// MHz-rate polling should go through that interface instead of WhiteBox.
 WB_ENTRY(jint, WB_GetCompileQueueSize(JNIEnv* env, jobject o, jint comp_level))
   if (comp_level == CompLevel_any) {
     return CompileBroker::queue_size(CompLevel_full_optimization) /* C2 */ +
@@ -864,6 +864,13 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
+  product(uintx, InlineCacheBufferSize, 10*K, DIAGNOSTIC,                   \
+          "Size in bytes of the buffer for inline cache transition "        \
+          "stubs. Exhausting the buffer forces a cleanup safepoint, "       \
+          "so a larger buffer reduces ICBufferFull safepoints during "      \
+          "warmup of call-site-rich code")                                  \
+          range(1*K, 32*M)                                                  \
+                                                                            \
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
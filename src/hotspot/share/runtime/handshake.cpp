@@ -335,6 +335,19 @@ void HandshakeOperation::do_handshake(JavaThread* thread) {
   // It is no longer safe to refer to 'this' as the VMThread/Handshaker may have destroyed this operation
 }
 
+// The all-threads form is synchronous by construction: one operation is
+// queued on every thread, laggards can be executed on their behalf by
+// the VMThread, and the initiator returns only when _pending_threads
+// reaches zero — so one slow thread defines the caller's latency.  The
+// asynchronous form below is per-target only.  An aggregated async
+// variant (one shared operation across all threads, initiator returns
+// immediately, a completion callback fired by whichever thread
+// decrements the count to zero) has no mechanical blocker in
+// HandshakeState, but it inverts the current ownership rule that the
+// initiator's stack owns the operation and its closure; the operation
+// and any resources the closure captures would need heap lifetime
+// released from the last finisher's context, as AsyncHandshakeOperation
+// already does for single targets.
 void Handshake::execute(HandshakeClosure* hs_cl) {
   HandshakeOperation cto(hs_cl, NULL, Thread::current());
   VM_HandshakeAllThreads handshake(&cto);
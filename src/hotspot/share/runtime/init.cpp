@@ -108,6 +108,18 @@ void vm_init_globals() {
 }
 
 
+// The serial ordering here is mostly real data dependence, not accident:
+// nearly every phase emits code (stubs, interpreter, adapters) and all of
+// them share one CodeCache and one assembler-time view of VM_Version
+// flags, while universe/javaClasses/interpreter form a chain where each
+// consumes the previous phase's published globals.  The phases that are
+// genuinely independent (perf memory, event logs, oop storages) already
+// run in vm_init_globals above, and are too small to pay for a bootstrap
+// pool.  Splitting stub generation per stub would also need the blob
+// buffers and StubRoutines:: entry publication to become thread-safe for
+// a one-time ~100ms win; profile before reaching for that - on small
+// containers the dominant cold-start cost is usually after this function,
+// in class loading and first-use compilation, not here.
 jint init_globals() {
   management_init();
   JvmtiExport::initialize_oop_storage();
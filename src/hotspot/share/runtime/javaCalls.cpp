@@ -330,6 +330,18 @@ void JavaCalls::call(JavaValue* result, const methodHandle& method, JavaCallArgu
   os::os_exception_wrapper(call_helper, result, method, args, THREAD);
 }
 
+// Embedders making the same upcall at high rate sometimes ask for a
+// "prepared call" that caches the resolved entry and argument layout
+// across invocations.  Little of this function is actually cacheable:
+// from_interpreted_entry must be re-read per call anyway (it changes
+// under compilation, deoptimization and interp-only mode — caching it
+// would need an invalidation hook on all three), and the remaining
+// per-call work is mandatory re-entry protocol, not resolution: stack
+// reguard and shadow page bang, the JavaCallWrapper thread-state
+// transition with its handle and resource marks, and copying arguments
+// into the frame the call stub builds.  The supported way to amortize
+// upcall overhead is to keep the call count down (batching on the Java
+// side), not to thin this path.
 void JavaCalls::call_helper(JavaValue* result, const methodHandle& method, JavaCallArguments* args, TRAPS) {
 
   JavaThread* thread = THREAD;
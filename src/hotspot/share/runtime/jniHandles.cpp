@@ -335,6 +335,13 @@ void JNIHandleBlock::zap() {
 }
 #endif // ASSERT
 
+// Block allocation needs no global lock: each thread keeps released
+// blocks on its own free_handle_block list (see release_block), so the
+// common allocate/release cycle of a JNI call never leaves the thread.
+// Only a thread's first block and growth beyond what it has released
+// reach the C heap, where the allocator provides its own per-thread
+// caching; a shared lock-free block pool would merely duplicate that
+// and keep blocks alive that the allocator could otherwise reuse.
 JNIHandleBlock* JNIHandleBlock::allocate_block(JavaThread* thread, AllocFailType alloc_failmode)  {
   // The VM thread can allocate a handle block in behalf of another thread during a safepoint.
   assert(thread == NULL || thread == Thread::current() || SafepointSynchronize::is_at_safepoint(),
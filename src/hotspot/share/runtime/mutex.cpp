@@ -83,6 +83,17 @@ void Mutex::check_no_safepoint_state(Thread* thread) {
 }
 #endif // ASSERT
 
+// On contention we go straight to PlatformMonitor::lock with no VM-side
+// spin phase.  That is intentional rather than an oversight: modern
+// platform mutexes (glibc adaptive futexes, Windows SRW-backed critical
+// sections) already spin briefly before blocking, so a second spin loop
+// here mostly burns cycles twice, and for JavaThreads the expensive part
+// of this path is the safepoint-state transition bracketing the park,
+// which spinning does not avoid.  Per-lock adaptive spin state would
+// also have to be maintained for the hundreds of Mutex instances that
+// are rarely contended.  Locks whose critical sections are short enough
+// to profit from pure spinning should use a lock-free structure or a
+// dedicated spin lock, as the code cache and GC already do.
 void Mutex::lock_contended(Thread* self) {
   DEBUG_ONLY(int retry_cnt = 0;)
   bool is_active_Java_thread = self->is_active_Java_thread();
@@ -1835,6 +1835,17 @@ void ObjectMonitor::notifyAll(TRAPS) {
 // situation is not dire.  The state is benign -- there's no need to add
 // hysteresis control to damp the transition rate between spinning and
 // not spinning.
+//
+// What this feedback loop does not model is topology: successor
+// selection in ExitEpilog takes the entry list as-is, so on multi-socket
+// machines the monitor can ping-pong between nodes even when a same-node
+// waiter exists.  A locality-preferring wakeup would need the waiting
+// thread's node recorded in its ObjectWaiter at enqueue time and a
+// bounded preference scan at exit — bounded, because always favoring
+// the owner's node starves remote waiters and breaks the existing
+// fairness properties of the cxq/EntryList discipline.  Any such policy
+// change needs multi-socket benchmarking behind a flag; the spin side
+// already adapts per monitor via _SpinDuration.
 
 // Spinning: Fixed frequency (100%), vary duration
 int ObjectMonitor::TrySpin(JavaThread* current) {
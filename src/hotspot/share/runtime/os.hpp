@@ -562,6 +562,17 @@ class os: AllStatic {
   static bool same_files(const char* file1, const char* file2);
 
   //File i/o operations
+  //
+  // All of these are synchronous by design.  Consumers that must not
+  // block on slow storage (the JFR chunk writer, the heap dumper's
+  // compression pipeline, async unified logging) each push the blocking
+  // write onto a dedicated worker thread, which keeps the failure and
+  // flush semantics local to the subsystem.  A shared asynchronous
+  // facility (io_uring with a thread-pool fallback) would centralize
+  // those workers, but it adds a completion-dispatch layer that every
+  // current consumer would still wrap in its own ordering and
+  // error-propagation logic, and the VM must stay functional on kernels
+  // and platforms without any async submission interface.
 
   static ssize_t read(int fd, void *buf, unsigned int nBytes);
   static ssize_t read_at(int fd, void *buf, unsigned int nBytes, jlong offset);
@@ -294,6 +294,17 @@ void PerfDataManager::destroy() {
   _constants = NULL;
 }
 
+// The lock below is a creation-time cost only: counter *updates* are
+// plain stores into the counter's PerfMemory slot and take no lock, so
+// a subsystem that wants guaranteed lock-free hot paths just creates
+// its counters at init rather than lazily on first use — no new arena
+// machinery required.  The external side is more constrained: the
+// region layout is a sequence of variable-length entries (see
+// PerfDataEntry in perfMemory.hpp) that scrapers discover by walking,
+// and entries only ever append, so a reader may cache each entry's
+// data offset after one walk and re-read by offset thereafter.  A
+// versioned fixed index would be a PerfMemory format revision that
+// every jstat/jvmstat consumer has to understand.
 void PerfDataManager::add_item(PerfData* p, bool sampled) {
 
   MutexLocker ml(PerfDataManager_lock);
@@ -1130,6 +1130,19 @@ static oop invoke(InstanceKlass* klass,
 // This would be nicer if, say, java.lang.reflect.Method was a subclass
 // of java.lang.reflect.Constructor
 
+// Performance note: this entry point is intentionally not the steady
+// state for repeated reflective calls, so it carries no memoization.
+// Core reflection routes a Method's first few invocations through the
+// native accessor (which lands here, re-resolving and re-checking access
+// each time) and then spins a bytecode accessor that calls the target
+// with a plain invoke - at that point resolution and access decisions
+// are cached by the JIT's inline caches and constant-folded checks, which
+// is strictly better than any VM-side memo attached to the Method oop.
+// Callers that hit this path millions of times are fighting the
+// inflation threshold (-Dsun.reflect.inflationThreshold), not a missing
+// cache.  A memo here would also need the same invalidation hooks as
+// compiled code (class redefinition, hierarchy changes) for a window the
+// accessor machinery already closes after ~15 calls.
 oop Reflection::invoke_method(oop method_mirror, Handle receiver, objArrayHandle args, TRAPS) {
   oop mirror             = java_lang_reflect_Method::clazz(method_mirror);
   int slot               = java_lang_reflect_Method::slot(method_mirror);
@@ -760,6 +760,16 @@ void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
 }
 
 
+// The built-in way to attribute a slow time-to-safepoint today:
+// -XX:+SafepointTimeout -XX:SafepointTimeoutDelay=<ms> names every
+// thread still running when the threshold passes (below), and
+// AbortVMOnSafepointTimeout can force the offender to dump its own
+// stack via the error handler.  That covers post-hoc hunts; a
+// continuously running TTSP histogram with native-stack capture of
+// laggards would need per-thread arrival timestamps recorded during
+// the sync spin in begin() (they are only aggregated today, see
+// SafepointTracing) and an async-signal-safe backtrace on every
+// platform, which is why it is not done inline here.
 void SafepointSynchronize::print_safepoint_timeout() {
   if (!timeout_error_printed) {
     timeout_error_printed = true;
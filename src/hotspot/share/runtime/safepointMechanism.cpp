@@ -111,6 +111,19 @@ void SafepointMechanism::update_poll_values(JavaThread* thread) {
   }
 }
 
+// Much of what a "native-thread exemption" would buy already holds.
+// Single-thread operations go through handshakes, which arm only the
+// target's local poll; threads in native are safepoint-safe and are never
+// waited for; and a thread returning from native after the operation
+// completed finds its poll disarmed and takes the fast path without
+// reaching here.  The residual cost on native-heavy threads is the poll
+// load in the transition itself, which is also the correctness hook - the
+// returning thread may need its stack processed (StackWatermarkSet
+// below) before touching any oop, so it cannot be skipped based on
+// JavaThreadState alone.  For attribution, SafepointTracing logs
+// per-operation sync/cleanup times and JFR's SafepointBegin/End events
+// cover the VM-operation side; a per-thread poll-hit counter would sit
+// on this hot path to measure a load it thereby perturbs.
 void SafepointMechanism::process(JavaThread *thread, bool allow_suspend) {
   // Read global poll and has_handshake after local poll
   OrderAccess::loadload();
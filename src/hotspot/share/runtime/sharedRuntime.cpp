@@ -132,7 +132,16 @@ void SharedRuntime::generate_stubs() {
 // Implementation of SharedRuntime
 
 #ifndef PRODUCT
-// For statistics
+// For statistics.  On productizing these: the counters bumped from C++
+// runtime entries (IC miss, resolution, rethrow) would cost one relaxed
+// increment on paths that are already slow, and could be exposed through
+// PerfData like other runtime counters.  What keeps the block !PRODUCT is
+// the rest of it - the stub and arraycopy counters are incremented by
+// code each platform's stub generators emit only in non-product builds,
+// so flipping the gate means revisiting every port's generated
+// increments, and per-caller-nmethod attribution would add a code cache
+// lookup of the caller PC to paths like the IC miss handler that can run
+// hot in storms, which is exactly when the measurement must stay cheap.
 int SharedRuntime::_ic_miss_ctr = 0;
 int SharedRuntime::_wrong_method_ctr = 0;
 int SharedRuntime::_resolve_static_ctr = 0;
@@ -2817,6 +2826,19 @@ AdapterHandlerEntry* AdapterHandlerLibrary::get_adapter(const methodHandle& meth
   // the AdapterHandlerTable (it is not safe for concurrent readers
   // and a single writer: this could be fixed if it becomes a
   // problem).
+  //
+  // Two things bound the cost of this lock before reworking the table.
+  // The simple-adapter path below resolves the handful of signatures that
+  // dominate real programs without taking the lock at all, and a method
+  // caches its adapter at link time, so each distinct signature pays the
+  // locked lookup once per lifetime rather than once per compile.  If
+  // contention ever shows past those, the fix is porting the fingerprint
+  // table to ConcurrentHashTable for lock-free readers - not archiving
+  // generated adapters in CDS, which would require relocatable code blobs
+  // (adapter code bakes in calling-convention choices that depend on the
+  // runtime's VM_Version configuration, and CDS archives no CodeCache
+  // contents today).
+
   assert(_adapters != NULL, "Uninitialized");
 
   // Fast-path for trivial adapters
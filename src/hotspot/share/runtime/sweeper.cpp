@@ -195,6 +195,18 @@ CodeBlobClosure* NMethodSweeper::prepare_mark_active_nmethods() {
 /**
   * This function triggers a VM operation that does stack scanning of active
   * methods. Stack scanning is mandatory for the sweeper to make progress.
+  *
+  * Note that the scan no longer stops the world: it is a per-thread
+  * handshake, and each thread walks only its own frames.  The sweep
+  * itself (sweep_code_cache) also yields the CodeCache_lock between
+  * small batches, so a large code cache is reclaimed incrementally
+  * rather than in one pause.  What still requires these hot-method
+  * marking rounds at all is that an nmethod's activity is proven by
+  * observation of stacks; retiring that in favor of purely concurrent
+  * reclamation means gating every nmethod entry through
+  * BarrierSetNMethod epochs so coldness can be established from the
+  * barrier state alone, which changes the invocation path on every
+  * platform rather than this policy code.
   */
 void NMethodSweeper::do_stack_scanning() {
   assert(!CodeCache_lock->owned_by_self(), "just checking");
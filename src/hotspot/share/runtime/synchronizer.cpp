@@ -1318,6 +1318,15 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
 
 // Walk the in-use list and deflate (at most MonitorDeflationMax) idle
 // ObjectMonitors. Returns the number of deflated ObjectMonitors.
+//
+// Deflation does not monopolize the thread even after a churn burst
+// leaves millions of monitors extant: MonitorDeflationMax bounds the
+// work per cycle, and every step of the walk (and of the later unlink
+// and delete loops) yields to pending safepoints and handshakes through
+// chk_for_block_req, so handshake latency is bounded by one monitor
+// step, not one cycle.  The single global list is what keeps the
+// capped remainder fair — per-thread in-use shards would also need
+// ownership migration for monitors that outlive their inflating thread.
 size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
                                                 elapsedTimer* timer_p) {
   MonitorList::Iterator iter = _in_use_list.iterator();
@@ -1355,6 +1364,23 @@ class HandshakeForDeflation : public HandshakeClosure {
 // This function is called by the MonitorDeflationThread to deflate
 // ObjectMonitors. It is also called via do_final_audit_and_print_stats()
 // by the VMThread.
+//
+// On inflate/deflate churn: per-class inflation visibility already exists
+// as the JFR JavaMonitorInflate event, which carries the monitor's class
+// and the inflation cause; aggregate counts are in the Inflations/
+// Deflations perf counters.  A VM-side sidecar map from Klass to
+// inflation stats would additionally need unloading hooks to avoid dead
+// Klass keys, which is why the event-based attribution is preferred.
+// For workloads where periodic contention causes inflate storms, the
+// deflation side is already tunable without a per-class policy:
+// AsyncDeflationInterval and GuaranteedAsyncDeflationInterval control how
+// eagerly this thread runs, and MonitorUsedDeflationThreshold keeps it
+// idle until the in-use list grows - raising the interval keeps recently
+// contended monitors inflated across traffic waves.  A per-class
+// "never deflate" bit would have to be consulted in deflate_monitor()
+// after the owner check, where the monitor's object is not necessarily
+// alive; that ordering problem, more than the policy itself, is what a
+// future change here has to solve.
 size_t ObjectSynchronizer::deflate_idle_monitors() {
   Thread* current = Thread::current();
   if (current->is_Java_thread()) {
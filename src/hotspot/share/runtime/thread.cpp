@@ -1960,6 +1960,16 @@ void JavaThread::pop_jni_handle_block() {
   JNIHandleBlock::release_block(old_handles, this);
 }
 
+// Unlike the Java frames, which collectors with stack watermarks can
+// leave for lazy per-thread processing (the return barrier guarantees a
+// frame is fixed before re-entry), these no-frame roots are always
+// processed up front.  There is no equivalent interception point: JNI
+// handle blocks are dereferenced by compiled native wrappers that
+// inline the jobject load, and oops like _vm_result are read directly
+// by generated return paths.  Deferring them would require a resolve
+// barrier in every one of those generated sequences, so the
+// thread-count-proportional pause cost of this function is bounded by
+// keeping it cheap, not by making it lazy.
 void JavaThread::oops_do_no_frames(OopClosure* f, CodeBlobClosure* cf) {
   // Verify that the deferred card marks have been flushed.
   assert(deferred_card_mark().is_empty(), "Should be empty during GC");
@@ -3480,6 +3490,18 @@ jboolean Threads::is_supported_jni_version(jint version) {
 }
 
 
+// On bulk thread registration: spinning up a large pool serializes here,
+// but the lock hold itself is short - list insert, SMR list publication
+// and service accounting.  The per-thread costs that dominate pool
+// spin-up (stack creation in os::create_thread, the Java thread object,
+// initial TLAB) all happen outside Threads_lock.  The part that would
+// benefit from batching is ThreadsSMRSupport::add_thread, which publishes
+// a fresh copy of the ThreadsList per addition, making N starts O(N^2)
+// in list copying; a bulk path could build one new list for N threads.
+// There is no caller for it, though: java.lang.Thread.start() is
+// specified one thread at a time, with each thread observably runnable
+// before the next is created, so a batch API would need a new library
+// entry point before the VM side is worth building.
 void Threads::add(JavaThread* p, bool force_daemon) {
   // The threads lock must be owned at this point
   assert(Threads_lock->owned_by_self(), "must have threads lock");
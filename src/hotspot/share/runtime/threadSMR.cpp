@@ -408,6 +408,18 @@ class VerifyHazardPtrThreadClosure : public ThreadClosure {
 
 // Acquire a stable ThreadsList.
 //
+// The publish-verify-retry protocol below costs a fenced store per
+// acquire, which monitoring code that snapshots the thread list at high
+// frequency can see in profiles.  A GlobalCounter-style epoch read
+// section would make acquisition a plain critical-section enter, but it
+// only bounds reclamation if every reader passes through a quiescent
+// state promptly — exactly what ThreadsListHandles cannot promise, since
+// they are held across blocking operations (thread dumps, JVMTI
+// callbacks, handshakes with the very threads on the list).  Mixing the
+// two (epochs for short-lived handles, hazard pointers for long-held
+// ones) would need every exit path to know which discipline its handle
+// used; the single hazard-pointer discipline is kept because the
+// freeing side, not the acquire fence, is where SMR correctness lives.
 void SafeThreadsListPtr::acquire_stable_list() {
   assert(_thread != NULL, "sanity check");
   _needs_release = true;
@@ -493,6 +493,15 @@ intptr_t* vframeArray::unextended_sp() const {
   return _original.unextended_sp();
 }
 
+// C-heap allocation is deliberate even though it is per deopt event:
+// the array must outlive the Java frames it describes — it is created
+// in fetch_unroll_info and consumed later in unpack_frames, after the
+// compiled frame has been popped — so any resource-arena storage would
+// be gone by the time it is read.  The element payloads (locals,
+// expressions, monitor chunks) are also per-thread state that cannot be
+// shared across threads deoptimizing the same nmethod; only the scope
+// decode that produced `chunk` is thread-independent, and that already
+// goes through each nmethod's PcDescCache.
 vframeArray* vframeArray::allocate(JavaThread* thread, int frame_size, GrowableArray<compiledVFrame*>* chunk,
                                    RegisterMap *reg_map, frame sender, frame caller, frame self,
                                    bool realloc_failures) {
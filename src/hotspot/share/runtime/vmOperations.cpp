@@ -265,6 +265,17 @@ void VM_ThreadDump::doit_epilogue() {
   }
 }
 
+// The pause cost of this operation scales with thread count times stack
+// depth, so frequent dumps of thousands of threads are better served by
+// per-thread handshakes than by this global safepoint.  Two pieces keep
+// it here for now: the deadlock/ownership views (concurrent locks,
+// locked synchronizers) relate threads to each other and are only
+// consistent against a single stopped snapshot of all of them, and the
+// MXBean contract returns one coherent array.  A handshake-based
+// variant is sound for the plain stacks-only dump; caching frames
+// between dumps additionally needs a cheap invalidation signal, and the
+// only trustworthy one is "no safepoint/deopt touched this frame",
+// which the VM does not track per frame today.
 void VM_ThreadDump::doit() {
   ResourceMark rm;
 
@@ -337,6 +337,15 @@ void VMThread::setup_periodic_safepoint_if_needed() {
   }
 }
 
+// There is no operation queue to coalesce: a single _next_vm_operation
+// slot is handed off at a time and each requester spins in
+// wait_until_executed until its own op has run, so "safepoint trains"
+// are back-to-back slot installs by independent requesters.  Merging
+// compatible operations into one safepoint would mean reintroducing a
+// queue, giving operations a compatibility relation, and untying the
+// requester-blocks-on-own-op protocol — and the cheaper answer for most
+// train producers is converting them to handshakes, which is how other
+// former VM operations already left this path.
 bool VMThread::set_next_operation(VM_Operation *op) {
   if (_next_vm_operation != NULL) {
     return false;
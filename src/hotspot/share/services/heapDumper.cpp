@@ -688,6 +688,19 @@ class ParWriterBufferQueue : public CHeapObj<mtInternal> {
 };
 
 // Support parallel heap dump.
+//
+// Parallelism already spans the expensive half of the dump: the object
+// iteration is partitioned across dumper workers via the heap's
+// parallel_object_iterator, each worker emits independent HPROF segments,
+// and writer workers drain these queues through the shared
+// CompressionBackend.  The remaining serial component is the single
+// output file descriptor.  Bypassing the page cache with O_DIRECT would
+// additionally require sector-aligned buffer sizes and a per-platform
+// open path, and loses the cache only for the dump file, so it should be
+// justified by measurement before the buffer layout here is constrained
+// by it.  Progress is currently observable only via logging; a perfData
+// counter would need updating from the writer side, where byte counts
+// are totalled.
 class ParDumpWriter : public AbstractDumpWriter {
  private:
   // Lock used to guarantee the integrity of multiple buffers writing.
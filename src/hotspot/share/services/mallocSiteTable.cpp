@@ -113,6 +113,17 @@ bool MallocSiteTable::walk(MallocSiteWalker* walker) {
  *    1. Out of memory, it cannot allocate new hash entry.
  *    2. Overflow hash bucket.
  *  Under any of above circumstances, caller should handle the situation.
+ *
+ *  On detail-mode overhead: this path is already lock-free for lookups
+ *  (CAS inserts, stable chains, shared access via an atomic reader
+ *  count), so the per-malloc cost is dominated by capturing the
+ *  NativeCallStack and by cache-line traffic on the reader count and on
+ *  hot sites' counters.  Thread-local (hash -> counters) caches flushed
+ *  periodically would absorb the counter traffic, but frees must credit
+ *  the exact site recorded in the malloc header — possibly from a
+ *  different thread — and reports/baselines would see bounded-stale
+ *  numbers until all threads flush, including threads parked in native.
+ *  The stack capture cost remains either way.
  */
 MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, size_t* bucket_idx,
   size_t* pos_idx, MEMFLAGS flags) {
@@ -49,6 +49,21 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
   as_snapshot()->copy_to(s);
 }
 
+// The sorted linked list gives O(n) lookups, which is tolerable at the
+// usual few hundred reserved regions but degrades on configurations that
+// map thousands (e.g. ZGC's multi-mapped heap views).  Any replacement
+// with O(log n) insert/split has to respect two constraints that shaped
+// the current choice: every mutation runs under ThreadCritical - the
+// structure is touched from paths as delicate as thread stack creation,
+// so rebalancing work done inside that scope directly extends a global
+// critical section - and nodes are allocated with the NMT arena
+// machinery, since allocating through the normal tracked paths from in
+// here would recurse.  A sorted array with binary search meets both more
+// easily than a tree (one allocation, cheap search, memmove on insert),
+// and is the shape to reach for first.  Baseline/diff speed is a
+// different problem: memBaseline copies the whole list per snapshot, and
+// would need delta tracking here (a mutation counter per region) before
+// incremental diffs could be trusted.
 SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
@@ -176,6 +176,17 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
   // important to examine that first word with a minimum of fuss,
   // minimizing setup time for later words that will be wasted if the
   // first word is indeed interesting.
+  //
+  // The word loop below already leans on hardware bit instructions
+  // (count_trailing_zeros compiles to tzcnt/ctz, population_count in
+  // the .cpp to popcnt), so the residual cost on sparse maps is purely
+  // the zero words visited.  Skipping those wholesale needs a summary
+  // level (one bit per block of words) maintained by every set/clear —
+  // including the concurrent par_set_bit users, whose CAS on the word
+  // cannot atomically cover a second level — so a summary belongs in a
+  // cooperating owner like a marking bitmap that can bound when the
+  // summary is read relative to when bits are published, not in this
+  // general-purpose class.
 
   // The benefit from aligned_right being true is relatively small.
   // It saves an operation in the setup for the word search loop.
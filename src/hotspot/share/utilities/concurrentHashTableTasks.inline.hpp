@@ -41,6 +41,15 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
   ConcurrentHashTable<CONFIG, F>* _cht;
 
   // Default size of _task_size_log2
+  // Claiming is a single fetch_and_add per range, so the granularity
+  // knob is this constant: 4096 buckets per task caps usable
+  // parallelism at table_size/4096 workers.  Shrinking it is safe but
+  // raises per-claim overhead; a smarter scheme would size tasks from
+  // the worker count at setup().  Note that the chained-node layout
+  // itself is load-bearing for the users of this table: readers keep
+  // raw pointers to values inside nodes across GlobalCounter critical
+  // sections, which an open-addressing (Swiss-table style) layout that
+  // relocates entries on insert or resize could not honor.
   static const size_t DEFAULT_TASK_SIZE_LOG2 = 12;
 
   // The table is split into ranges, every increment is one range.
@@ -173,11 +173,17 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
+    // Format outside the lock: the expensive part of logging is the
+    // vsnprintf, and doing it on the stack first keeps the mutex hold
+    // time down to a bounded copy, so loggers on hot paths serialize
+    // only briefly against each other and against crash-time printing.
+    FormatStringLogMessage<bufsz> msg;
+    msg.printv(format, ap);
     MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
     int index = this->compute_log_index();
     this->_records[index].thread = thread;
     this->_records[index].timestamp = timestamp;
-    this->_records[index].data.printv(format, ap);
+    this->_records[index].data.print("%s", (const char*)msg);
   }
 
   void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(3, 4) {
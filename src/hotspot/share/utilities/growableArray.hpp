@@ -487,6 +487,19 @@ public:
   void clear_and_deallocate();
 };
 
+// Growth copies into a freshly allocated, power-of-two-sized backing
+// array.  For the dominant users — arena-allocated arrays in compiler
+// and runtime resource scopes — the abandoned old backing is a bump
+// pointer's worth of arena memory, not a C-heap churn, and doubling
+// amortizes the element copies.  An inline-small-storage variant would
+// pay its buffer in every instance (most GrowableArrays are themselves
+// arena- or stack-allocated, so the first allocation is already cheap)
+// and would break the embedded-supers layout contract documented at the
+// top of this file.  Chunked no-copy growth trades the single
+// indirection in at() for a chunk lookup on a structure whose main use
+// is indexed access; callers that only append and iterate already have
+// better-fitting structures (e.g. linked chunks in opto's Node_List
+// arenas).
 template <typename E, typename Derived>
 void GrowableArrayWithAllocator<E, Derived>::grow(int j) {
   int old_max = this->_max;
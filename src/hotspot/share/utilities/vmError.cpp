@@ -519,6 +519,20 @@ void VMError::clear_step_start_time() {
 // could be nested report_and_die() calls on stack (see above). Only one
 // thread can report error, so large buffers are statically allocated in data
 // segment.
+//
+// For deployments where restart latency matters more than hs_err
+// completeness, the controls already exist: ErrorLogTimeout caps total
+// reporting time (each STEP is individually interruptible, so a hung
+// walk forfeits only that section), and the report is ordered so the
+// cheap, reliable state - error message, registers, faulting stack,
+// the Events rings, which are exactly a continuously maintained
+// in-memory snapshot - prints before the expensive heap and thread
+// walks.  Maintaining a fuller preserialized snapshot from a background
+// task buys little over that: the crashing thread's stack and registers,
+// the part that matters, cannot be pre-captured, and anything else the
+// snapshot would hold is either already in Events or available post
+// mortem from the core file, which remains the supported path for
+// deferred full forensics.
 void VMError::report(outputStream* st, bool _verbose) {
 
 # define BEGIN if (_current_step == 0) { _current_step = __LINE__;
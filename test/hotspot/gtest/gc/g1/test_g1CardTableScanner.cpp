@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardTableScanner.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+typedef G1CardTableScanner::CardValue CardValue;
+
+// Enough words to cover several of the scanner's multi-word blocks.
+static const size_t num_words = 16;
+static const size_t cards_per_word = sizeof(size_t);
+static const size_t num_cards = num_words * cards_per_word;
+
+// Card array with the word alignment the scanner requires.
+struct TestCardTable {
+  size_t _words[num_words];
+
+  CardValue* cards() { return (CardValue*)_words; }
+
+  void fill_with(CardValue value) {
+    memset(_words, value, num_cards);
+  }
+
+  void set_word(size_t word_index, CardValue value) {
+    memset(&_words[word_index], value, sizeof(size_t));
+  }
+};
+
+TEST(G1CardTableScannerTest, all_clean) {
+  TestCardTable ct;
+  ct.fill_with(G1CardTable::clean_card_val());
+
+  G1CardTableScanner scan(ct.cards(), num_cards);
+  EXPECT_EQ(num_cards, scan.find_next_dirty());
+}
+
+TEST(G1CardTableScannerTest, all_dirty) {
+  TestCardTable ct;
+  ct.fill_with(G1CardTable::dirty_card_val());
+
+  G1CardTableScanner scan(ct.cards(), num_cards);
+  EXPECT_EQ((size_t)0, scan.find_next_dirty());
+  EXPECT_EQ(num_cards, scan.find_next_non_dirty());
+}
+
+TEST(G1CardTableScannerTest, single_dirty_card) {
+  TestCardTable ct;
+  ct.fill_with(G1CardTable::clean_card_val());
+  ct.cards()[40] = G1CardTable::dirty_card_val();
+
+  G1CardTableScanner scan(ct.cards(), num_cards);
+  EXPECT_EQ((size_t)40, scan.find_next_dirty());
+  EXPECT_EQ((size_t)41, scan.find_next_non_dirty());
+}
+
+TEST(G1CardTableScannerTest, clean_word_in_dirty_block) {
+  // A mixed block - an all-clean word surrounded by all-dirty words - must
+  // terminate the dirty range at the clean word's first card instead of
+  // being skipped over by the block-at-a-time search.
+  TestCardTable ct;
+  ct.fill_with(G1CardTable::dirty_card_val());
+  ct.set_word(1, G1CardTable::clean_card_val());
+
+  G1CardTableScanner scan(ct.cards(), num_cards);
+  EXPECT_EQ((size_t)0, scan.find_next_dirty());
+  EXPECT_EQ(cards_per_word, scan.find_next_non_dirty());
+}
+
+TEST(G1CardTableScannerTest, clean_word_at_every_position) {
+  for (size_t w = 1; w < num_words; w++) {
+    TestCardTable ct;
+    ct.fill_with(G1CardTable::dirty_card_val());
+    ct.set_word(w, G1CardTable::clean_card_val());
+
+    G1CardTableScanner scan(ct.cards(), num_cards);
+    EXPECT_EQ((size_t)0, scan.find_next_dirty()) << "clean word at " << w;
+    EXPECT_EQ(w * cards_per_word, scan.find_next_non_dirty()) << "clean word at " << w;
+  }
+}
+
+TEST(G1CardTableScannerTest, alternating_ranges) {
+  // Dirty ranges of varying length separated by single clean cards.
+  TestCardTable ct;
+  ct.fill_with(G1CardTable::clean_card_val());
+  size_t range_starts[] = { 3, 10, 33, 50 };
+  size_t range_ends[]   = { 9, 30, 49, num_cards };
+  for (size_t i = 0; i < ARRAY_SIZE(range_starts); i++) {
+    for (size_t c = range_starts[i]; c < range_ends[i]; c++) {
+      ct.cards()[c] = G1CardTable::dirty_card_val();
+    }
+  }
+
+  G1CardTableScanner scan(ct.cards(), num_cards);
+  for (size_t i = 0; i < ARRAY_SIZE(range_starts); i++) {
+    EXPECT_EQ(range_starts[i], scan.find_next_dirty()) << "range " << i;
+    EXPECT_EQ(range_ends[i], scan.find_next_non_dirty()) << "range " << i;
+  }
+}
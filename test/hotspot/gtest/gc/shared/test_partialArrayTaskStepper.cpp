@@ -72,6 +72,28 @@ static void run_test(int length, int chunk_size, uint n_workers) {
   ASSERT_EQ(tasks, length / chunk_size);
 }
 
+TEST(PartialArrayTaskStepperTest, chunk_size) {
+  const int base = 50;
+  for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
+    const PartialArrayTaskStepper stepper(n_workers);
+    // Small arrays use the base chunk size unchanged.
+    ASSERT_EQ(base, stepper.chunk_size(0, base));
+    ASSERT_EQ(base, stepper.chunk_size(1000, base));
+    for (int length = 1; length <= 100000000; length *= 10) {
+      int chunk = stepper.chunk_size(length, base);
+      ASSERT_LE(base, chunk);
+      // Scaled chunk sizes keep the chunk count bounded but still
+      // provide many more chunks than workers.
+      if (chunk > base) {
+        ASSERT_LE((uint)(length / chunk), n_workers * 64u);
+        ASSERT_GT((uint)(length / (chunk / 2)), n_workers * 64u);
+      }
+      // The size is a pure function of the arguments.
+      ASSERT_EQ(chunk, stepper.chunk_size(length, base));
+    }
+  }
+}
+
 TEST(PartialArrayTaskStepperTest, doit) {
   for (int chunk_size = 50; chunk_size <= 500; chunk_size += 50) {
     for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Functional tests for GenericTaskQueue, plus a small steal throughput
+// microbenchmark, so that regressions in the work stealing protocol and
+// its backoff heuristics show up in test times.
+
+typedef GenericTaskQueue<size_t, mtGC> TestQueue;
+typedef GenericTaskQueueSet<TestQueue, mtGC> TestQueueSet;
+
+TEST_VM(TaskQueue, pop_local_is_lifo) {
+  TestQueue* queue = new TestQueue();
+  const size_t nelements = 100;
+  for (size_t i = 0; i < nelements; i++) {
+    ASSERT_TRUE(queue->push(i));
+  }
+  ASSERT_EQ(nelements, (size_t)queue->size());
+  for (size_t i = nelements; i > 0; i--) {
+    size_t value;
+    ASSERT_TRUE(queue->pop_local(value));
+    ASSERT_EQ(i - 1, value);
+  }
+  ASSERT_TRUE(queue->is_empty());
+  delete queue;
+}
+
+TEST_VM(TaskQueue, pop_global_is_fifo) {
+  TestQueue* queue = new TestQueue();
+  const size_t nelements = 100;
+  for (size_t i = 0; i < nelements; i++) {
+    ASSERT_TRUE(queue->push(i));
+  }
+  for (size_t i = 0; i < nelements; i++) {
+    size_t value;
+    ASSERT_TRUE(queue->pop_global(value));
+    ASSERT_EQ(i, value);
+  }
+  ASSERT_TRUE(queue->is_empty());
+  delete queue;
+}
+
+TEST_VM(TaskQueue, fill_to_max_elems) {
+  TestQueue* queue = new TestQueue();
+  for (uint i = 0; i < queue->max_elems(); i++) {
+    ASSERT_TRUE(queue->push((size_t)i));
+  }
+  ASSERT_FALSE(queue->push(0));
+  size_t value;
+  ASSERT_TRUE(queue->pop_local(value));
+  ASSERT_TRUE(queue->push(value));
+  delete queue;
+}
+
+class TaskQueueStealThread : public JavaTestThread {
+private:
+  TestQueueSet* _queues;
+  uint          _queue_num;
+  size_t        _stolen;
+  size_t        _sum;
+
+public:
+  TaskQueueStealThread(Semaphore* post, TestQueueSet* queues, uint queue_num) :
+      JavaTestThread(post),
+      _queues(queues),
+      _queue_num(queue_num),
+      _stolen(0),
+      _sum(0) {}
+
+  size_t stolen() const { return _stolen; }
+  size_t sum() const { return _sum; }
+
+  virtual void main_run() {
+    // Nothing is ever pushed during the test, so all work lives in queue 0
+    // and the test is done when that queue is drained.
+    while (!_queues->queue(0)->is_empty()) {
+      size_t value;
+      if (_queues->steal(_queue_num, value)) {
+        _stolen++;
+        _sum += value;
+      }
+    }
+  }
+};
+
+TEST_VM(TaskQueue, steal_from_many_threads) {
+  const uint nstealers = 4;
+  const size_t nelements = 10000;
+
+  TestQueueSet* queues = new TestQueueSet(nstealers + 1);
+  for (uint i = 0; i < nstealers + 1; i++) {
+    queues->register_queue(i, new TestQueue());
+  }
+
+  size_t expected_sum = 0;
+  for (size_t i = 0; i < nelements; i++) {
+    ASSERT_TRUE(queues->queue(0)->push(i));
+    expected_sum += i;
+  }
+
+  Semaphore post;
+  TaskQueueStealThread* stealers[nstealers];
+  for (uint i = 0; i < nstealers; i++) {
+    stealers[i] = new TaskQueueStealThread(&post, queues, i + 1);
+  }
+
+  Ticks start = Ticks::now();
+  for (uint i = 0; i < nstealers; i++) {
+    stealers[i]->doit();
+  }
+  for (uint i = 0; i < nstealers; i++) {
+    post.wait();
+  }
+  Tickspan duration = Ticks::now() - start;
+
+  size_t total_stolen = 0;
+  size_t total_sum = 0;
+  for (uint i = 0; i < nstealers; i++) {
+    total_stolen += stealers[i]->stolen();
+    total_sum += stealers[i]->sum();
+  }
+  ASSERT_EQ(nelements, total_stolen);
+  ASSERT_EQ(expected_sum, total_sum);
+
+  tty->print_cr("TaskQueue steal throughput: " SIZE_FORMAT " steals by %u threads in %.3fms",
+                total_stolen, nstealers, duration.seconds() * MILLIUNITS);
+
+  for (uint i = 0; i < nstealers + 1; i++) {
+    delete queues->queue(i);
+  }
+  delete queues;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Arrays;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+import java.util.zip.CRC32;
+
+/**
+ * Exercises the HotSpot stub routines behind the common bulk intrinsics
+ * (arraycopy, array fill, CRC32, String comparison) across sizes that
+ * cover the small/medium/large dispatch thresholds in the generated
+ * stubs, and across a misaligned variant. Intended as a per-platform
+ * regression baseline for stub changes.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Fork(3)
+public class StubRoutineIntrinsics {
+
+    @Param({"16", "256", "4096", "65536"})
+    public int size;
+
+    // A small offset defeats the aligned fast path in the copy stubs.
+    @Param({"0", "1"})
+    public int misalign;
+
+    private byte[] srcBytes;
+    private byte[] dstBytes;
+    private long[] srcLongs;
+    private long[] dstLongs;
+    private Object[] srcOops;
+    private Object[] dstOops;
+    private String strA;
+    private String strB;
+    private CRC32 crc;
+
+    @Setup
+    public void setup() {
+        Random r = new Random(42);
+        srcBytes = new byte[size + misalign];
+        dstBytes = new byte[size + misalign];
+        r.nextBytes(srcBytes);
+        srcLongs = new long[size + misalign];
+        dstLongs = new long[size + misalign];
+        for (int i = 0; i < srcLongs.length; i++) {
+            srcLongs[i] = r.nextLong();
+        }
+        srcOops = new Object[size + misalign];
+        dstOops = new Object[size + misalign];
+        for (int i = 0; i < srcOops.length; i++) {
+            srcOops[i] = srcBytes;
+        }
+        char[] chars = new char[size];
+        for (int i = 0; i < size; i++) {
+            chars[i] = (char) ('a' + r.nextInt(26));
+        }
+        strA = new String(chars);
+        chars[size - 1] ^= 1;
+        strB = new String(chars);
+        crc = new CRC32();
+    }
+
+    @Benchmark
+    public byte[] byteArraycopy() {
+        System.arraycopy(srcBytes, misalign, dstBytes, 0, size);
+        return dstBytes;
+    }
+
+    @Benchmark
+    public long[] longArraycopy() {
+        System.arraycopy(srcLongs, misalign, dstLongs, 0, size);
+        return dstLongs;
+    }
+
+    @Benchmark
+    public Object[] oopArraycopy() {
+        System.arraycopy(srcOops, misalign, dstOops, 0, size);
+        return dstOops;
+    }
+
+    @Benchmark
+    public byte[] byteArrayFill() {
+        Arrays.fill(dstBytes, (byte) 0x5a);
+        return dstBytes;
+    }
+
+    @Benchmark
+    public long crc32() {
+        crc.reset();
+        crc.update(srcBytes, 0, size);
+        return crc.getValue();
+    }
+
+    @Benchmark
+    public int stringCompareTo() {
+        return strA.compareTo(strB);
+    }
+
+    @Benchmark
+    public int stringIndexOf() {
+        return strA.indexOf(strB.charAt(size - 1));
+    }
+}